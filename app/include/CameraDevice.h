@@ -13,11 +13,25 @@ typedef int errno_t;
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include "CameraRemote_SDK.h"
 #include "IDeviceCallback.h"
 #include "ConnectionInfo.h"
+#include "PropertyBatch.h"
+#include "PropertyChangeQueue.h"
+#include "PropertyHistory.h"
+#include "PropertyRegistry.h"
+#include "PropertySubscriptions.h"
 #include "PropertyValueTable.h"
+#include "LiveViewFocus.h"
+#include "LiveViewHttpServer.h"
+#include "LiveViewMultiplexer.h"
+#include "LiveViewOverlay.h"
+#include "LiveViewSharedMemory.h"
+#include "LiveViewStream.h"
+#include "LiveViewWriter.h"
 #include "Text.h"
 #include "MessageDefine.h"
 
@@ -85,7 +99,49 @@ public:
     void get_focus_mode();
     void get_focus_area();
     void get_live_view();
+    void start_live_view_stream();
+    void stop_live_view_stream();
+    void start_live_view_recording();
+    void stop_live_view_recording();
+    void seek_live_view_capture();
+    void start_live_view_server();
+    void stop_live_view_server();
+    void start_live_view_shm();
+    void stop_live_view_shm();
+    void get_live_view_stream_status();
+    void get_live_view_latency();
+    void get_live_view_overlay();
     void get_live_view_image_quality();
+    void get_live_view_focus();
+    // Stall one subscriber for a while and check the stream keeps fetching
+    void check_live_view_stall();
+    // Every property the camera reports, from the generic registry
+    void get_all_properties();
+    // Time the decode of the full property list into a PropertyValueTable
+    void get_property_decode_benchmark();
+    void set_live_view_target_fps();
+    // Feed this camera's live view into a multi-camera multiplexer, fetching on core cpu (-1: any)
+    bool join_live_view_multiplexer(LiveViewMultiplexer& mux, int cpu);
+    void set_live_view_target_fps(double fps) { m_lv_stream.set_target_fps(fps); }
+    void leave_live_view_multiplexer(LiveViewMultiplexer& mux);
+    LiveViewStream const& live_view_stream() const { return m_lv_stream; }
+    // Latest property table, consistent and safe to read from any thread. Republished by the
+    // property worker after every change the camera reports, also while the menu thread is idle.
+    std::shared_ptr<PropertySnapshot const> property_snapshot() const { return m_prop_subscriptions.snapshot(); }
+    // Set a batch of properties, stage by stage as ordered by property_stage(). Every assignment of a
+    // stage is sent back to back, then all of them are confirmed by a single wait. Sets each result;
+    // true when every assignment was confirmed within timeout.
+    bool apply_properties(std::vector<PropertyAssignment>& batch, std::chrono::milliseconds timeout);
+    // Read a batch from the console and apply it
+    void apply_property_batch();
+    // Up to max of the latest property changes of code, or of every property, newest first
+    std::size_t property_history(PropertyChange* out, std::size_t max, CrInt32u code = PropertyHistory::AnyCode) const { return m_prop_history.recent(out, max, code); }
+    // Print the property change history
+    void get_property_history();
+    // Subscribe to property changes, delivered on a worker thread and never on the SDK callback thread
+    PropertySubscriptions& property_subscriptions() { return m_prop_subscriptions; }
+    // Print the changes of a few status properties as they arrive
+    void watch_properties();
     void get_af_area_position();
     void get_select_media_format();
     void get_white_balance();
@@ -235,9 +291,18 @@ public:
     virtual void OnNotifyContentsTransfer(CrInt32u notify, SCRSDK::CrContentHandle contentHandle, CrChar* filename) override;
 
 private:
-    void load_properties(CrInt32u num = 0, CrInt32u* codes = nullptr);
+    bool load_properties(CrInt32u num = 0, CrInt32u* codes = nullptr);
+    // Bring m_prop up to date with the codes reported by OnPropertyChangedCodes()
+    void refresh_properties();
+    // Wait up to timeout until predicate accepts the current value of property code.
+    // Refreshes whenever OnPropertyChangedCodes() reports a change, so it returns as soon as the camera confirms.
+    bool await_property(CrInt32u code, std::function<bool(CrInt64u)> const& predicate, std::chrono::milliseconds timeout);
+    bool await_property_value(CrInt32u code, CrInt64u value, std::chrono::milliseconds timeout);
+    // Wait until the camera reports the value of every pending assignment in [first, last)
+    bool await_assignments(PropertyAssignment* first, PropertyAssignment* last, std::chrono::steady_clock::time_point deadline);
     void get_property(SCRSDK::CrDeviceProperty& prop) const;
-    bool set_property(SCRSDK::CrDeviceProperty& prop) const;
+    // Send prop to the camera, noting the write in the property history
+    SCRSDK::CrError set_property(SCRSDK::CrDeviceProperty& prop) const;
     text format_dispstrlist(SCRSDK::CrDisplayStringListInfo list);
     text format_display_string_type(SCRSDK::CrDisplayStringType type);
     void check_monitoringstatus();
@@ -250,8 +315,19 @@ private:
     ConnectionType m_conn_type;
     NetworkInfo m_net_info;
     UsbInfo m_usb_info;
-    PropertyValueTable m_prop;
+    PropertyValueTable m_prop; // working table of the thread loading properties
+    PropertyChangeQueue m_prop_changes;
+    std::vector<CrInt32u> m_prop_refresh_codes;
+    PropertyRegistry m_prop_registry;
+    mutable PropertyHistory m_prop_history; // set_property() notes its writes, also from const members
+    PropertySubscriptions m_prop_subscriptions;
     bool m_lvEnbSet;
+    LiveViewStream m_lv_stream;
+    LiveViewWriter m_lv_writer;
+    LiveViewHttpServer m_lv_http;
+    LiveViewShmPublisher m_lv_shm;
+    LiveViewOverlayBuffer m_lv_overlay;
+    LiveViewFocusMeter m_lv_focus;
     SCRSDK::CrSdkControlMode m_modeSDK;
     MtpFolderList   m_foldList;
     MtpContentsList m_contentList;
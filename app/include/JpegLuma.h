@@ -0,0 +1,94 @@
+#ifndef JPEGLUMA_H
+#define JPEGLUMA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cli
+{
+
+// 8-bit luma plane, row-major. stride >= width, rows past height may hold padding.
+struct LumaPlane
+{
+    std::vector<std::uint8_t> pixels;
+    int width;
+    int height;
+    int stride;
+
+    LumaPlane()
+        : pixels()
+        , width(0)
+        , height(0)
+        , stride(0)
+    {}
+
+    std::uint8_t const* row(int y) const { return pixels.data() + static_cast<std::size_t>(y) * stride; }
+};
+
+// Quarter-resolution luma of a baseline (SOF0/SOF1, 8-bit, Huffman) JPEG such as a live-view frame.
+// Every output pixel is the exact mean of a 4x4 quadrant of an 8x8 block, computed from the
+// dequantized DC and odd AC coefficients only; no full IDCT and no chroma decode.
+// Decoding stops after the scan holding the luma component.
+// Tables and the output buffer are kept between calls, so steady-state decoding does not allocate.
+class JpegLumaDecoder
+{
+public:
+    JpegLumaDecoder();
+
+    bool decode(std::uint8_t const* data, std::size_t size, LumaPlane& plane);
+
+    // Why the last decode() failed
+    char const* error() const { return m_error; }
+
+private:
+    struct Huffman
+    {
+        std::uint8_t fast_length[512]; // 9-bit lookahead, 0: longer code
+        std::uint8_t fast_value[512];
+        std::int16_t fast_ac[512];     // AC only, code and value within 9 bits: value << 8 | run << 4 | length
+        std::int32_t max_code[18];     // per length, -1: none
+        std::int32_t offset[17];       // values index minus first code, per length
+        std::uint8_t values[256];
+        bool defined;
+    };
+
+    struct Component
+    {
+        std::uint8_t id;
+        std::uint8_t h;
+        std::uint8_t v;
+        std::uint8_t quant;
+        std::uint8_t dc_table;
+        std::uint8_t ac_table;
+        std::int32_t dc_pred;
+    };
+
+    class BitReader;
+
+    bool fail(char const* error);
+    bool parse_quant(std::uint8_t const* p, std::size_t length);
+    bool parse_huffman(std::uint8_t const* p, std::size_t length);
+    bool parse_frame(std::uint8_t const* p, std::size_t length);
+    bool decode_scan(std::uint8_t const* p, std::size_t length, std::uint8_t const*& data, std::uint8_t const* end, LumaPlane& plane);
+    bool decode_block(BitReader& bits, Component& component, bool luma, float* coef);
+    void store_block(float const* coef, int bx, int by, LumaPlane& plane) const;
+
+private:
+    std::uint16_t m_quant[4][64];  // natural order
+    Huffman m_dc[4];
+    Huffman m_ac[4];
+    Component m_components[4];
+    int m_component_count;
+    int m_width;
+    int m_height;
+    int m_max_h;
+    int m_max_v;
+    unsigned m_restart_interval;
+    bool m_has_frame;
+    char const* m_error;
+};
+
+} // namespace cli
+
+#endif // !JPEGLUMA_H
@@ -0,0 +1,36 @@
+#ifndef JPEGVALIDATOR_H
+#define JPEGVALIDATOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cli
+{
+
+enum class JpegStatus
+{
+    Valid,
+    TooShort,
+    MissingSoi,   // does not start with FF D8
+    BadSegment,   // marker segment length runs past the buffer, or garbage between segments
+    MissingSos,   // EOI or end of buffer before any scan
+    MissingEoi    // entropy-coded data runs to the end of the buffer (truncated frame)
+};
+
+// Structural check of a baseline or progressive JPEG without decoding it:
+// SOI, every marker segment length up to each SOS, the entropy-coded data up to
+// the next marker and finally EOI. The search for markers inside the entropy-coded
+// data, where nearly all the bytes are, uses AVX2 or SSE2 when the CPU has them
+// and memchr() otherwise.
+JpegStatus check_jpeg(std::uint8_t const* data, std::size_t size);
+
+inline bool is_valid_jpeg(std::uint8_t const* data, std::size_t size)
+{
+    return JpegStatus::Valid == check_jpeg(data, size);
+}
+
+char const* to_string(JpegStatus status);
+
+} // namespace cli
+
+#endif // !JPEGVALIDATOR_H
@@ -0,0 +1,54 @@
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace cli
+{
+
+// HDR-style log-linear histogram of non-negative integer samples (microseconds by convention).
+// Values below 128 are counted exactly, above that every power of two is split into
+// 64 linear buckets, so a reported value is within 1/64 (~1.6%) of the recorded one.
+// record() is lock-free and may be called from any thread, readers see a close snapshot.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    LatencyHistogram(LatencyHistogram const&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram const&) = delete;
+
+    void record(std::uint64_t value);
+    void reset();
+
+    std::uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    std::uint64_t min() const;
+    std::uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+    double mean() const;
+    // Smallest recorded value (bucket upper bound) that percentile percent of the samples do not exceed
+    std::uint64_t percentile(double percent) const;
+
+private:
+    static constexpr unsigned SubBucketBits = 7;
+    static constexpr std::uint64_t SubBucketCount = 1ull << SubBucketBits;
+    static constexpr std::uint64_t SubBucketHalf = SubBucketCount / 2;
+    // Up to 2^36 us (~19 hours), larger samples land in the last bucket
+    static constexpr unsigned MaxValueBits = 36;
+    static constexpr std::size_t BucketCount = (MaxValueBits - SubBucketBits + 2) * SubBucketHalf;
+
+    static std::size_t index_of(std::uint64_t value);
+    static std::uint64_t highest_of(std::size_t index);
+
+private:
+    std::array<std::atomic<std::uint64_t>, BucketCount> m_buckets;
+    std::atomic<std::uint64_t> m_count;
+    std::atomic<std::uint64_t> m_sum;
+    std::atomic<std::uint64_t> m_min;
+    std::atomic<std::uint64_t> m_max;
+};
+
+} // namespace cli
+
+#endif // !LATENCYHISTOGRAM_H
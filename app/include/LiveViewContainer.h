@@ -0,0 +1,134 @@
+#ifndef LIVEVIEWCONTAINER_H
+#define LIVEVIEWCONTAINER_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "CrTypes.h"
+#include "Text.h"
+
+namespace cli
+{
+
+// Live-view capture container
+//
+//   FileHeader
+//   RecordHeader, JPEG payload, padding to 8 bytes   (once per frame)
+//   IndexEntry[count]
+//   Footer
+//
+// The file is only ever appended to. The index and footer are written when the
+// recording is closed; a file without them (recording interrupted) is still
+// readable, the reader then rebuilds the index by walking the records.
+// All fields are stored in host (little-endian) byte order.
+namespace lvc
+{
+constexpr CrInt32u const FileMagic = 0x43564C43;   // "CLVC"
+constexpr CrInt32u const RecordMagic = 0x52464C56; // "VLFR"
+constexpr CrInt32u const IndexMagic = 0x58494C56;  // "VLIX"
+constexpr CrInt32u const Version = 1;
+constexpr std::size_t const Alignment = 8;
+
+struct FileHeader
+{
+    CrInt32u magic;
+    CrInt32u version;
+    CrInt32u header_size;
+    CrInt32u reserved;
+    std::int64_t system_start_ns; // wall clock at the start of the recording
+};
+
+struct RecordHeader
+{
+    CrInt32u magic;
+    CrInt32u size;      // JPEG payload size, excluding padding
+    CrInt32u frame_no;  // CrImageDataBlock::GetFrameNo()
+    CrInt32u time_code; // CrImageDataBlock::GetTimeCode()
+    std::int64_t host_time_ns; // steady clock, relative to the start of the recording
+};
+
+struct IndexEntry
+{
+    std::uint64_t offset; // of the RecordHeader
+    CrInt32u frame_no;
+    CrInt32u time_code;
+    std::int64_t host_time_ns;
+};
+
+struct Footer
+{
+    std::uint64_t index_offset;
+    std::uint64_t count;
+    CrInt32u magic;
+    CrInt32u version;
+};
+
+static_assert(sizeof(FileHeader) % Alignment == 0, "FileHeader must keep records aligned");
+static_assert(sizeof(RecordHeader) == 24, "RecordHeader layout");
+static_assert(sizeof(IndexEntry) == 24, "IndexEntry layout");
+static_assert(sizeof(Footer) == 24, "Footer layout");
+
+inline std::size_t padding(std::size_t size)
+{
+    return (Alignment - size % Alignment) % Alignment;
+}
+} // namespace lvc
+
+// One frame of a mapped capture, data points into the mapping
+struct LiveViewRecord
+{
+    CrInt32u frame_no;
+    CrInt32u time_code;
+    std::chrono::nanoseconds host_time; // since the start of the recording
+    CrInt8u const* data;
+    CrInt32u size;
+};
+
+// Memory-mapped, read-only view of a live-view capture container.
+// Seeking by time code or host time is a binary search over the index.
+class LiveViewContainerReader
+{
+public:
+    LiveViewContainerReader();
+    ~LiveViewContainerReader();
+
+    LiveViewContainerReader(LiveViewContainerReader const&) = delete;
+    LiveViewContainerReader& operator=(LiveViewContainerReader const&) = delete;
+
+    bool open(text const& path);
+    void close();
+    bool is_open() const { return nullptr != m_base; }
+
+    // False when the trailing index was missing and had to be rebuilt
+    bool indexed() const { return m_indexed; }
+    std::size_t size() const { return m_count; }
+    std::chrono::system_clock::time_point start_time() const;
+
+    LiveViewRecord record(std::size_t index) const;
+
+    // Index of the first record at or after the given time, size() if there is none
+    std::size_t seek_time_code(CrInt32u time_code) const;
+    std::size_t seek_host_time(std::chrono::nanoseconds host_time) const;
+
+private:
+    bool load_index();
+    void rebuild_index();
+
+private:
+    CrInt8u const* m_base;
+    std::size_t m_length;
+#if defined(_WIN32) || defined(_WIN64)
+    void* m_file;
+    void* m_mapping;
+#endif
+    bool m_indexed;
+    std::size_t m_count;
+    lvc::IndexEntry const* m_entries; // into the mapping, or m_rebuilt
+    std::vector<lvc::IndexEntry> m_rebuilt;
+    // Record order sorted by time code, only needed when the time code is not monotonic
+    std::vector<std::uint32_t> m_time_code_order;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWCONTAINER_H
@@ -0,0 +1,100 @@
+#ifndef LIVEVIEWFOCUS_H
+#define LIVEVIEWFOCUS_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "JpegLuma.h"
+#include "LatencyHistogram.h"
+#include "LiveViewOverlay.h"
+#include "LiveViewStream.h"
+
+namespace cli
+{
+
+// Pixel rectangle of a LumaPlane
+struct FocusRoi
+{
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+// Variance of the 4-neighbour Laplacian over roi, a contrast-based focus score: higher is sharper.
+// Only pixels with all four neighbours inside roi contribute. SSE2 or NEON when available.
+double laplacian_variance(LumaPlane const& plane, FocusRoi const& roi);
+
+// Bounding box of the focus frames of overlay on plane, the whole plane when there are none
+FocusRoi focus_roi(LiveViewOverlay const& overlay, LumaPlane const& plane);
+
+struct LiveViewFocusResult
+{
+    std::uint64_t sequence;   // results so far, 0: none yet
+    CrInt32u frame_no;
+    CrInt32u time_code;
+    double score;
+    FocusRoi roi;
+    bool focus_frames;        // roi taken from CrFocusFrameInfo, otherwise the whole frame
+    std::int64_t decode_us;
+    std::int64_t kernel_us;
+};
+
+// Scores every live-view frame on its own thread: quarter-resolution luma decode,
+// then laplacian_variance() over the ROI of the current focus frames.
+// Like every consumer it reads from its own ring, so a slow score never stalls the fetch.
+class LiveViewFocusMeter
+{
+public:
+    LiveViewFocusMeter();
+    ~LiveViewFocusMeter();
+
+    LiveViewFocusMeter(LiveViewFocusMeter const&) = delete;
+    LiveViewFocusMeter& operator=(LiveViewFocusMeter const&) = delete;
+
+    bool start(LiveViewStream& stream, LiveViewOverlayBuffer const& overlay);
+    void stop();
+    bool is_running() const { return m_running.load(std::memory_order_acquire); }
+
+    LiveViewFocusResult latest() const;
+    // Wait up to timeout for a result newer than sequence
+    bool wait_newer(std::uint64_t sequence, std::chrono::milliseconds timeout, LiveViewFocusResult& result) const;
+
+    std::uint64_t scored() const { return m_scored.load(std::memory_order_relaxed); }
+    std::uint64_t decode_failed() const { return m_decode_failed.load(std::memory_order_relaxed); }
+    std::uint64_t dropped() const;
+
+    // Frame fetch to its score, microseconds
+    LatencyHistogram const& score_age() const { return m_score_age; }
+
+private:
+    void run();
+
+private:
+    LiveViewStream* m_stream;
+    LiveViewOverlayBuffer const* m_overlay;
+    std::shared_ptr<LiveViewFrameRing> m_ring;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    // Scoring thread only
+    JpegLumaDecoder m_decoder;
+    LumaPlane m_plane;
+
+    LiveViewFocusResult m_latest;
+    mutable std::mutex m_latest_mtx;
+    mutable std::condition_variable m_latest_cv;
+
+    std::atomic<std::uint64_t> m_scored;
+    std::atomic<std::uint64_t> m_decode_failed;
+    std::uint64_t m_dropped_before;
+    LatencyHistogram m_score_age;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWFOCUS_H
@@ -0,0 +1,100 @@
+#ifndef LIVEVIEWFRAMEPOOL_H
+#define LIVEVIEWFRAMEPOOL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "CrImageDataBlock.h"
+
+namespace cli
+{
+
+// A live-view frame backed by a pooled image buffer.
+// The buffer is handed to GetLiveViewImage() through the embedded CrImageDataBlock,
+// the remaining members are a snapshot of the block taken right after the fetch.
+struct LiveViewFrame
+{
+    SCRSDK::CrImageDataBlock block;
+    std::unique_ptr<CrInt8u[]> buffer;
+    CrInt32u capacity;
+
+    CrInt8u const* data;  // JPEG payload inside buffer
+    CrInt32u size;        // JPEG payload size
+    CrInt32u frame_no;
+    CrInt32u time_code;
+    std::int32_t camera;  // number of the source camera, 0 if untagged
+    std::chrono::steady_clock::time_point timestamp;
+
+    std::atomic<int> refs; // 0:free, >0:number of holders
+
+    LiveViewFrame()
+        : capacity(0)
+        , data(nullptr)
+        , size(0)
+        , frame_no(0)
+        , time_code(0)
+        , camera(0)
+        , refs(0)
+    {}
+};
+
+// Set of live-view frames recycled across GetLiveViewImage() calls.
+// Buffers are only reallocated when the camera reports a larger buffer size,
+// so steady-state streaming never allocates.
+// The set grows with the frames its holders may keep, see LiveViewStream::subscribe(),
+// and never shrinks; frames are only ever added up to MaxFrameCount.
+class LiveViewFramePool
+{
+public:
+    // Frames before anybody subscribes
+    static constexpr std::size_t DefaultFrameCount = 16;
+    static constexpr std::size_t MaxFrameCount = 256;
+
+    explicit LiveViewFramePool(std::size_t count = DefaultFrameCount);
+
+    LiveViewFramePool(LiveViewFramePool const&) = delete;
+    LiveViewFramePool& operator=(LiveViewFramePool const&) = delete;
+
+    // Request every frame to hold at least buffer_size bytes. Never shrinks.
+    void reserve(CrInt32u buffer_size);
+
+    // Add frames until there are count of them, at most MaxFrameCount. Any thread, also while
+    // the producer acquires; the buffers are allocated by the first acquire() of each frame.
+    // Returns the number of frames.
+    std::size_t grow_to(std::size_t count);
+
+    // Take a free frame sized for the current buffer size, nullptr if all frames are held.
+    // The returned frame has one reference owned by the caller.
+    LiveViewFrame* acquire();
+
+    // Share a frame held by the caller with another holder.
+    static void add_ref(LiveViewFrame* frame);
+
+    // Drop one reference, the frame becomes free again with the last one.
+    static void release(LiveViewFrame* frame);
+
+    CrInt32u buffer_size() const { return m_buffer_size.load(std::memory_order_relaxed); }
+    std::size_t size() const { return m_count.load(std::memory_order_acquire); }
+    std::size_t in_use() const;
+    std::uint64_t grow_count() const { return m_grow_count.load(std::memory_order_relaxed); }
+
+private:
+    void grow(LiveViewFrame& frame, CrInt32u buffer_size);
+
+private:
+    // MaxFrameCount slots, the first m_count filled. A slot is filled before m_count covers it
+    // and never changes afterwards, so acquire() reads it without a lock.
+    std::vector<std::unique_ptr<LiveViewFrame>> m_frames;
+    std::atomic<std::size_t> m_count;
+    std::mutex m_grow_mtx;
+    std::atomic<CrInt32u> m_buffer_size;
+    std::atomic<std::uint64_t> m_grow_count;
+    std::size_t m_next; // acquire scan position, producer side only
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWFRAMEPOOL_H
@@ -0,0 +1,112 @@
+#ifndef LIVEVIEWFRAMERING_H
+#define LIVEVIEWFRAMERING_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "LiveViewFramePool.h"
+
+namespace cli
+{
+
+// Wakes a consumer sleeping until one of the rings sharing this signal gets a frame.
+// notify() is a fence and a load while nobody waits.
+class LiveViewFrameSignal
+{
+public:
+    LiveViewFrameSignal()
+        : m_waiters(0)
+    {}
+
+    LiveViewFrameSignal(LiveViewFrameSignal const&) = delete;
+    LiveViewFrameSignal& operator=(LiveViewFrameSignal const&) = delete;
+
+    // Producer, after publishing a frame
+    void notify()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 < m_waiters.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            m_cv.notify_all();
+        }
+    }
+
+    // Consumer: call take() until it returns non-null or timeout elapses
+    template <typename Take>
+    auto wait(std::chrono::milliseconds timeout, Take take) -> decltype(take())
+    {
+        auto result = take();
+        if (result) {
+            return result;
+        }
+        auto const deadline = std::chrono::steady_clock::now() + timeout;
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_waiters.fetch_add(1, std::memory_order_relaxed);
+        for (;;) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            result = take();
+            if (result || std::cv_status::timeout == m_cv.wait_until(lock, deadline)) {
+                break;
+            }
+        }
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result ? result : take();
+    }
+
+private:
+    std::atomic<int> m_waiters;
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+};
+
+// Lock-free single-producer/single-consumer queue of pooled live-view frames.
+// The producer never blocks: when the ring is full it takes the oldest frame
+// itself (CAS on the tail index), releases it back to the pool and counts the drop.
+class LiveViewFrameRing
+{
+public:
+    static constexpr std::size_t DefaultCapacity = 4;
+
+    // capacity is rounded up to a power of two.
+    // Rings consumed together share one signal, a ring without one gets its own.
+    explicit LiveViewFrameRing(std::size_t capacity = DefaultCapacity, std::shared_ptr<LiveViewFrameSignal> signal = nullptr);
+    ~LiveViewFrameRing();
+
+    LiveViewFrameRing(LiveViewFrameRing const&) = delete;
+    LiveViewFrameRing& operator=(LiveViewFrameRing const&) = delete;
+
+    // Producer: hand one frame reference to the consumer
+    void push(LiveViewFrame* frame);
+
+    // Consumer: take the oldest frame or nullptr if empty.
+    // The caller owns the returned reference and must release it.
+    LiveViewFrame* pop();
+
+    // Consumer: pop(), waiting up to timeout for the producer if the ring is empty
+    LiveViewFrame* pop_wait(std::chrono::milliseconds timeout);
+
+    // Release every queued frame. Safe from either side since both advance the tail by CAS
+    void clear();
+
+    std::size_t size() const;
+    std::size_t capacity() const { return m_mask + 1; }
+    std::uint64_t pushed() const { return m_head.load(std::memory_order_relaxed); }
+    std::uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+    std::shared_ptr<LiveViewFrameSignal> const& signal() const { return m_signal; }
+
+private:
+    std::unique_ptr<std::atomic<LiveViewFrame*>[]> m_slots;
+    std::size_t m_mask;
+    alignas(64) std::atomic<std::uint64_t> m_head; // written by the producer
+    alignas(64) std::atomic<std::uint64_t> m_tail; // written by the consumer, or the producer on overflow
+    alignas(64) std::atomic<std::uint64_t> m_dropped;
+
+    std::shared_ptr<LiveViewFrameSignal> m_signal;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWFRAMERING_H
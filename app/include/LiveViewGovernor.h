@@ -0,0 +1,69 @@
+#ifndef LIVEVIEWGOVERNOR_H
+#define LIVEVIEWGOVERNOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace cli
+{
+
+// Frame rate limit of one LiveViewStream, additive increase / multiplicative decrease.
+// The rate is cut by a quarter when a subscriber ring is three quarters full or overflows
+// (backlog), or when GetLiveViewImage() takes well over its usual time (the USB or network
+// link is shared with other cameras). It climbs back towards the ceiling, the target rate or
+// the camera rate whichever is lower, within about a second once the rings drain again.
+// Frames of the camera which fall between two governed polls are never fetched,
+// the poller reports them as skipped.
+// Updated by the fetch thread only, the rates may be read from any thread.
+class LiveViewGovernor
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr double MinFps = 1.0;
+
+    LiveViewGovernor();
+
+    void reset();
+
+    // 0: no target, follow the camera rate
+    void set_target_fps(double fps);
+    double target_fps() const { return m_target_fps.load(std::memory_order_relaxed); }
+
+    // A new frame was published.
+    // camera_interval: measured camera frame interval, fetch_latency: this GetLiveViewImage() call,
+    // fill: fullest subscriber ring before the push, 0 to 1 (1: the push dropped a frame).
+    void on_frame(clock::time_point now, clock::duration camera_interval, clock::duration fetch_latency, double fill);
+
+    // Earliest time for the next poll, clock::time_point() while not throttling
+    clock::time_point earliest_poll() const;
+
+    // Current limit in frames per second
+    double rate_fps() const { return m_rate_fps.load(std::memory_order_relaxed); }
+    // Below the target or camera rate because of backpressure
+    bool is_throttling() const { return m_throttling.load(std::memory_order_relaxed); }
+
+    std::uint64_t backlog_decreases() const { return m_backlog_decreases.load(std::memory_order_relaxed); }
+    std::uint64_t bandwidth_decreases() const { return m_bandwidth_decreases.load(std::memory_order_relaxed); }
+
+private:
+    bool m_has_frame;
+    clock::time_point m_last_frame;
+    clock::time_point m_hold_until;  // no further decrease before the last one took effect
+    double m_rate;
+    double m_camera_fps;             // last measured while not limiting
+    bool m_limiting;                 // rate below the camera rate, by target or backpressure
+    double m_latency_floor;          // microseconds, fastest recent GetLiveViewImage()
+    double m_latency_average;        // microseconds
+
+    std::atomic<double> m_target_fps;
+    std::atomic<double> m_rate_fps;
+    std::atomic<bool> m_throttling;
+    std::atomic<std::uint64_t> m_backlog_decreases;
+    std::atomic<std::uint64_t> m_bandwidth_decreases;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWGOVERNOR_H
@@ -0,0 +1,74 @@
+#ifndef LIVEVIEWHTTPSERVER_H
+#define LIVEVIEWHTTPSERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <thread>
+#include "LiveViewStream.h"
+
+namespace cli
+{
+
+// Serves the live view of one camera as multipart/x-mixed-replace MJPEG on a localhost port,
+// e.g. http://127.0.0.1:8080/ in a browser or cv::VideoCapture.
+// Every HTTP client gets its own LiveViewStream subscription and is sent the pooled frames
+// directly, so the SDK is polled once however many clients are connected.
+// A client that cannot keep up only loses its own oldest frames.
+class LiveViewHttpServer
+{
+public:
+    static constexpr std::uint16_t DefaultPort = 8080;
+
+    LiveViewHttpServer();
+    ~LiveViewHttpServer();
+
+    LiveViewHttpServer(LiveViewHttpServer const&) = delete;
+    LiveViewHttpServer& operator=(LiveViewHttpServer const&) = delete;
+
+    bool start(LiveViewStream& stream, std::uint16_t port = DefaultPort);
+    void stop();
+    bool is_running() const { return m_running.load(std::memory_order_acquire); }
+    std::uint16_t port() const { return m_port; }
+
+    std::size_t clients() const { return m_clients.load(std::memory_order_relaxed); }
+    std::uint64_t connections() const { return m_connections.load(std::memory_order_relaxed); }
+    std::uint64_t frames_sent() const { return m_frames_sent.load(std::memory_order_relaxed); }
+
+private:
+#if defined(_WIN32) || defined(_WIN64)
+    using socket_type = std::uintptr_t;
+#else
+    using socket_type = int;
+#endif
+
+    struct Client
+    {
+        socket_type socket;
+        std::shared_ptr<LiveViewFrameRing> ring;
+        std::thread thread;
+        std::atomic<bool> done;
+    };
+
+    void accept_loop();
+    void serve(Client* client);
+    void reap(bool all);
+
+private:
+    LiveViewStream* m_stream;
+    socket_type m_listen;
+    std::uint16_t m_port;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    std::list<Client> m_client_list; // owned by the accept thread, by stop() once it has joined
+
+    std::atomic<std::size_t> m_clients;
+    std::atomic<std::uint64_t> m_connections;
+    std::atomic<std::uint64_t> m_frames_sent;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWHTTPSERVER_H
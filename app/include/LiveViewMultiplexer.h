@@ -0,0 +1,79 @@
+#ifndef LIVEVIEWMULTIPLEXER_H
+#define LIVEVIEWMULTIPLEXER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "LiveViewFrameRing.h"
+#include "LiveViewStream.h"
+
+namespace cli
+{
+
+// Live view of several cameras at once.
+// Every camera keeps its own LiveViewStream fetch thread, optionally pinned to a core,
+// so cameras never wait on each other and throughput grows with the number of bodies.
+// Each stream feeds a per-camera SPSC ring; all rings share one LiveViewFrameSignal,
+// so the merged pop_wait() sleeps until any camera delivers a frame.
+// Frames carry the camera number in LiveViewFrame::camera.
+class LiveViewMultiplexer
+{
+public:
+    // held: frames per camera the consumer keeps popped, see LiveViewStream::subscribe()
+    explicit LiveViewMultiplexer(std::size_t ring_capacity = LiveViewFrameRing::DefaultCapacity, std::size_t held = 1);
+    ~LiveViewMultiplexer();
+
+    LiveViewMultiplexer(LiveViewMultiplexer const&) = delete;
+    LiveViewMultiplexer& operator=(LiveViewMultiplexer const&) = delete;
+
+    // Subscribe to the stream of a camera. The stream must stay alive until remove() or clear().
+    bool add(std::int32_t camera, LiveViewStream& stream);
+    void remove(std::int32_t camera);
+    void clear();
+
+    // Merged stream. Cameras are visited round robin, so a fast camera cannot starve a slow one.
+    // The caller owns the returned reference and must release it.
+    LiveViewFrame* pop();
+    LiveViewFrame* pop_wait(std::chrono::milliseconds timeout);
+
+    // Per-camera queue, nullptr if the camera was not added.
+    // Do not pop a camera's queue and the merged stream from different threads.
+    std::shared_ptr<LiveViewFrameRing> queue(std::int32_t camera) const;
+
+    std::size_t size() const;
+    bool contains(std::int32_t camera) const { return nullptr != queue(camera); }
+    std::vector<std::int32_t> cameras() const;
+
+    // Frames popped from the merged stream so far
+    std::uint64_t popped() const { return m_popped.load(std::memory_order_relaxed); }
+    // Frames the rings dropped because the consumer fell behind
+    std::uint64_t dropped() const;
+
+private:
+    struct Source
+    {
+        std::int32_t camera;
+        LiveViewStream* stream;
+        std::shared_ptr<LiveViewFrameRing> ring;
+    };
+    using SourceList = std::vector<Source>;
+
+private:
+    std::size_t m_ring_capacity;
+    std::size_t m_held;
+    std::shared_ptr<LiveViewFrameSignal> m_signal;
+
+    // Copy-on-write list, replaced under m_sources_mtx and read by the consumer with atomic_load
+    std::shared_ptr<SourceList const> m_sources;
+    std::mutex m_sources_mtx;
+
+    std::size_t m_next; // round-robin position, consumer side only
+    std::atomic<std::uint64_t> m_popped;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWMULTIPLEXER_H
@@ -0,0 +1,90 @@
+#ifndef LIVEVIEWOVERLAY_H
+#define LIVEVIEWOVERLAY_H
+
+#include <atomic>
+#include <cstdint>
+#include "CrTypes.h"
+
+namespace SCRSDK
+{
+class CrLiveViewProperty;
+}
+
+namespace cli
+{
+
+// A live-view frame overlay rectangle, normalized to the live-view image:
+// (x, y) is the center and (width, height) the size, all in [0, 1].
+struct LiveViewOverlayRect
+{
+    float x;
+    float y;
+    float width;
+    float height;
+    std::uint16_t type;    // CrFocusFrameType, CrFaceFrameType or CrTrackingFrameType
+    std::uint16_t state;   // CrFocusFrameState
+    std::uint8_t priority;
+    std::uint8_t selected; // CrFocusFrameSelectState, face frames only
+    std::uint16_t reserved;
+};
+
+// Every live-view overlay of a camera at one point in time, plain data in fixed arrays
+struct LiveViewOverlay
+{
+    static constexpr std::size_t MaxFocusFrames = 64;
+    static constexpr std::size_t MaxFaceFrames = 16;
+    static constexpr std::size_t MaxTrackingFrames = 8;
+
+    std::uint64_t version;  // number of updates so far, 0: nothing received
+    CrInt32u time_code;     // of the latest update, matches LiveViewFrame::time_code
+    std::uint8_t focus_count;
+    std::uint8_t face_count;
+    std::uint8_t tracking_count;
+    bool has_magnifier;
+    bool truncated;         // the camera reported more frames than fit
+    LiveViewOverlayRect magnifier;
+    LiveViewOverlayRect focus[MaxFocusFrames];
+    LiveViewOverlayRect face[MaxFaceFrames];
+    LiveViewOverlayRect tracking[MaxTrackingFrames];
+};
+
+// Double-buffered LiveViewOverlay of one camera.
+// update() runs on the SDK callback thread: it starts from the published overlay, decodes
+// only the changed live-view properties into the back buffer and flips it to the front.
+// read() never blocks the writer; it copies the front buffer and retries if that buffer
+// was reused while it was being copied, which takes two updates during a single copy.
+class LiveViewOverlayBuffer
+{
+public:
+    LiveViewOverlayBuffer();
+
+    LiveViewOverlayBuffer(LiveViewOverlayBuffer const&) = delete;
+    LiveViewOverlayBuffer& operator=(LiveViewOverlayBuffer const&) = delete;
+
+    // Writer side, a single thread
+    void update(SCRSDK::CrLiveViewProperty* properties, std::int32_t count);
+    void clear();
+
+    // Reader side, any thread
+    void read(LiveViewOverlay& overlay) const;
+    std::uint64_t version() const { return m_version.load(std::memory_order_acquire); }
+
+private:
+    struct alignas(64) Slot
+    {
+        std::atomic<std::uint32_t> seq; // odd while written
+        LiveViewOverlay overlay;
+    };
+
+    Slot& begin_write();
+    void end_write(Slot& slot);
+
+private:
+    Slot m_slots[2];
+    std::atomic<std::uint32_t> m_front;
+    std::atomic<std::uint64_t> m_version;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWOVERLAY_H
@@ -0,0 +1,62 @@
+#ifndef LIVEVIEWPOLLER_H
+#define LIVEVIEWPOLLER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "CrTypes.h"
+
+namespace cli
+{
+
+// Schedules GetLiveViewImage() calls from the frame numbers the camera reports.
+// The camera frame interval is measured from the arrival of new frames, the next
+// poll is placed just after the expected next frame and CrWarning_Frame_NotUpdated
+// retries are spaced at a fraction of that interval.
+// Updated by the fetch thread only, counters may be read from any thread.
+class LiveViewPoller
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    LiveViewPoller();
+
+    void reset();
+
+    // A frame was fetched. Returns false if it repeats the previous frame number.
+    bool on_frame(CrInt32u frame_no, clock::time_point now);
+
+    // The camera had no new frame yet
+    void on_not_updated(clock::time_point now);
+
+    clock::time_point next_poll() const { return m_next_poll; }
+    clock::duration frame_interval() const { return m_interval; }
+
+    std::uint64_t frames() const { return m_frames.load(std::memory_order_relaxed); }
+    std::uint64_t duplicated() const { return m_duplicated.load(std::memory_order_relaxed); }
+    std::uint64_t skipped() const { return m_skipped.load(std::memory_order_relaxed); }
+    std::uint64_t retries() const { return m_retries.load(std::memory_order_relaxed); }
+    // Measured frame interval in microseconds
+    std::int64_t interval_us() const { return m_interval_us.load(std::memory_order_relaxed); }
+
+private:
+    clock::duration retry_delay() const;
+
+private:
+    bool m_has_frame;
+    CrInt32u m_last_frame_no;
+    clock::time_point m_last_arrival;
+    clock::time_point m_next_poll;
+    clock::duration m_interval;
+    std::uint32_t m_misses; // NotUpdated retries since the last new frame
+
+    std::atomic<std::uint64_t> m_frames;
+    std::atomic<std::uint64_t> m_duplicated;
+    std::atomic<std::uint64_t> m_skipped;
+    std::atomic<std::uint64_t> m_retries;
+    std::atomic<std::int64_t> m_interval_us;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWPOLLER_H
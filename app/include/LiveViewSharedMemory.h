@@ -0,0 +1,147 @@
+#ifndef LIVEVIEWSHAREDMEMORY_H
+#define LIVEVIEWSHAREDMEMORY_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include "LiveViewStream.h"
+
+namespace cli
+{
+
+// Live-view frames published into a POSIX shared-memory segment (/dev/shm/<name> on Linux)
+//
+//   ShmHeader
+//   { ShmSlot, JPEG payload[slot_size] } * slot_count
+//
+// Frame k (counting from 0) goes to slot k % slot_count and header.published becomes k + 1
+// once it is complete. Every slot is guarded by a seqlock: seq is odd while the slot is
+// being rewritten. A reader takes the latest frame without copying it or making a syscall:
+//
+//   std::uint64_t k = header->published.load(acquire) - 1;
+//   ShmSlot const* slot = shm::slot(header, k);
+//   std::uint32_t seq = slot->seq.load(acquire);          // retry if odd
+//   ... use slot->size bytes at shm::payload(slot) ...
+//   std::atomic_thread_fence(acquire);
+//   if (slot->seq.load(relaxed) != seq) ...                // overwritten meanwhile, drop the result
+//
+// LiveViewShmReader wraps exactly this for C++ consumers.
+namespace shm
+{
+constexpr std::uint32_t const Magic = 0x4D48534C; // "LSHM"
+constexpr std::uint32_t const Version = 1;
+
+struct alignas(64) ShmHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t slot_count;
+    std::uint32_t slot_size;   // payload capacity of a slot
+    std::uint32_t slot_stride; // bytes from one ShmSlot to the next
+    std::uint32_t reserved;
+    std::atomic<std::uint64_t> published; // frames completely written so far
+};
+
+struct alignas(64) ShmSlot
+{
+    std::atomic<std::uint32_t> seq;
+    std::uint32_t frame_no;
+    std::uint32_t size;
+    std::uint32_t time_code;
+    std::int64_t host_time_ns; // steady clock of the publishing process
+    std::uint64_t index;       // k of the frame in the slot
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "seqlock must be address-free");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "published must be address-free");
+
+inline ShmSlot* slot(ShmHeader* header, std::uint64_t index)
+{
+    auto* base = reinterpret_cast<std::uint8_t*>(header) + sizeof(ShmHeader);
+    return reinterpret_cast<ShmSlot*>(base + (index % header->slot_count) * header->slot_stride);
+}
+
+inline ShmSlot const* slot(ShmHeader const* header, std::uint64_t index)
+{
+    return slot(const_cast<ShmHeader*>(header), index);
+}
+
+inline std::uint8_t const* payload(ShmSlot const* slot)
+{
+    return reinterpret_cast<std::uint8_t const*>(slot) + sizeof(ShmSlot);
+}
+} // namespace shm
+
+// Copies every new live-view frame once into the shared-memory ring, from its own thread
+class LiveViewShmPublisher
+{
+public:
+    static constexpr std::uint32_t DefaultSlotCount = 4;
+
+    LiveViewShmPublisher();
+    ~LiveViewShmPublisher();
+
+    LiveViewShmPublisher(LiveViewShmPublisher const&) = delete;
+    LiveViewShmPublisher& operator=(LiveViewShmPublisher const&) = delete;
+
+    // name is a shm_open() name such as "/crsdk_lv1". Not supported on Windows.
+    bool start(LiveViewStream& stream, std::string const& name, std::uint32_t slot_count = DefaultSlotCount);
+    void stop();
+    bool is_running() const { return m_running.load(std::memory_order_acquire); }
+    std::string const& name() const { return m_name; }
+
+    std::uint64_t published() const { return m_published.load(std::memory_order_relaxed); }
+    // Frames larger than a slot, not published
+    std::uint64_t oversized() const { return m_oversized.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    void publish(LiveViewFrame const* frame);
+
+private:
+    LiveViewStream* m_stream;
+    std::shared_ptr<LiveViewFrameRing> m_ring;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    std::string m_name;
+    shm::ShmHeader* m_header;
+    std::size_t m_length;
+
+    std::atomic<std::uint64_t> m_published;
+    std::atomic<std::uint64_t> m_oversized;
+};
+
+// Read side of a LiveViewShmPublisher segment, usable from any process
+class LiveViewShmReader
+{
+public:
+    LiveViewShmReader();
+    ~LiveViewShmReader();
+
+    LiveViewShmReader(LiveViewShmReader const&) = delete;
+    LiveViewShmReader& operator=(LiveViewShmReader const&) = delete;
+
+    bool open(std::string const& name);
+    void close();
+    bool is_open() const { return nullptr != m_header; }
+
+    // Number of frames published so far, the latest one is published() - 1
+    std::uint64_t published() const;
+
+    // Zero-copy access to frame index. Returns nullptr when the frame is not (or no longer)
+    // in the ring. The slot may be rewritten while it is in use, so the result only counts
+    // when valid(slot, seq) still holds afterwards.
+    shm::ShmSlot const* acquire(std::uint64_t index, std::uint32_t& seq) const;
+    bool valid(shm::ShmSlot const* slot, std::uint32_t seq) const;
+
+private:
+    shm::ShmHeader const* m_header;
+    std::size_t m_length;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWSHAREDMEMORY_H
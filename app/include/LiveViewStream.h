@@ -0,0 +1,146 @@
+#ifndef LIVEVIEWSTREAM_H
+#define LIVEVIEWSTREAM_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "CameraRemote_SDK.h"
+#include "LatencyHistogram.h"
+#include "LiveViewFramePool.h"
+#include "LiveViewFrameRing.h"
+#include "LiveViewGovernor.h"
+#include "LiveViewPoller.h"
+
+namespace cli
+{
+
+// Long-running live-view fetch for one camera.
+// Frames are fetched into a LiveViewFramePool whose buffers are sized from GetLiveViewImageInfo()
+// and grown only when the camera reports CrError_Memory_Insufficient.
+// start() runs the fetch on a dedicated thread which publishes every new frame
+// to the ring of each subscriber; a slow subscriber only loses its own oldest frames.
+// For that every subscription adds the frames it may hold to the pool, so whatever the
+// subscribers keep the fetch thread always finds a free frame.
+// The thread polls on the schedule of a LiveViewPoller and never republishes a frame number.
+// A LiveViewGovernor lowers the rate while subscribers fall behind or the link is shared.
+// Call latency, frame interval and polls per frame are recorded into histograms (microseconds).
+class LiveViewStream
+{
+public:
+    explicit LiveViewStream(std::size_t pool_frames = LiveViewFramePool::DefaultFrameCount);
+    ~LiveViewStream();
+
+    LiveViewStream(LiveViewStream const&) = delete;
+    LiveViewStream& operator=(LiveViewStream const&) = delete;
+
+    // Bind to a connected device and size the frame pool
+    SCRSDK::CrError open(SCRSDK::CrDeviceHandle device_handle);
+    void close();
+    bool is_open() const { return m_open; }
+
+    // Fetch the current live-view image into a pooled frame.
+    // On success the caller holds one reference to frame and must release() it.
+    // CrError_Memory_OutOfMemory is returned when every pooled frame is still held.
+    // Frames which are not a complete JPEG are dropped and reported as CrWarning_Frame_NotUpdated.
+    // Must not be called while the fetch thread is running.
+    SCRSDK::CrError fetch(LiveViewFrame*& frame);
+    void release(LiveViewFrame* frame) { LiveViewFramePool::release(frame); }
+
+    // Fetch thread
+    bool start();
+    void stop();
+    bool is_running() const { return m_running.load(std::memory_order_acquire); }
+
+    // Number stamped into LiveViewFrame::camera of every fetched frame
+    void set_camera(std::int32_t camera) { m_camera = camera; }
+    std::int32_t camera() const { return m_camera; }
+
+    // Pin the fetch thread to one core, -1 lets it run anywhere.
+    // Takes effect on the next poll when the thread is running.
+    void set_cpu(int cpu) { m_cpu.store(cpu, std::memory_order_relaxed); }
+    int cpu() const { return m_cpu.load(std::memory_order_relaxed); }
+    bool is_pinned() const { return m_pinned.load(std::memory_order_relaxed); }
+
+    // Frame rate limit, 0 for the camera rate. The governor may go lower under backpressure.
+    void set_target_fps(double fps) { m_governor.set_target_fps(fps); }
+    double target_fps() const { return m_governor.target_fps(); }
+
+    // Consumers. Every subscriber gets its own SPSC ring fed by the fetch thread.
+    // Rings hold pooled frames, so unsubscribe before the stream is destroyed.
+    // held is the most frames the consumer keeps popped at once, e.g. a batch being written;
+    // the pool grows by the ring capacity plus held.
+    std::shared_ptr<LiveViewFrameRing> subscribe(std::size_t capacity = LiveViewFrameRing::DefaultCapacity, std::size_t held = 1);
+    // Subscribe a ring created by the caller, e.g. one sharing a LiveViewFrameSignal with other streams
+    void subscribe(std::shared_ptr<LiveViewFrameRing> const& ring, std::size_t held = 1);
+    void unsubscribe(std::shared_ptr<LiveViewFrameRing> const& ring);
+
+    LiveViewFramePool const& pool() const { return m_pool; }
+    LiveViewPoller const& poller() const { return m_poller; }
+    LiveViewGovernor const& governor() const { return m_governor; }
+
+    std::uint64_t fetched() const { return m_fetched.load(std::memory_order_relaxed); }
+    std::uint64_t not_updated() const { return m_not_updated.load(std::memory_order_relaxed); }
+    std::uint64_t memory_insufficient() const { return m_memory_insufficient.load(std::memory_order_relaxed); }
+    std::uint64_t pool_exhausted() const { return m_pool_exhausted.load(std::memory_order_relaxed); }
+    std::uint64_t fetch_failed() const { return m_fetch_failed.load(std::memory_order_relaxed); }
+    std::uint64_t invalid_frames() const { return m_invalid_frames.load(std::memory_order_relaxed); }
+
+    // GetLiveViewImage() request to return, every call
+    LatencyHistogram const& fetch_latency() const { return m_fetch_latency; }
+    // Between the arrival of consecutive new frames
+    LatencyHistogram const& frame_interval() const { return m_frame_interval; }
+    // NotUpdated, duplicate and Memory_Insufficient polls before each new frame (a count, not a time)
+    LatencyHistogram const& retries_per_frame() const { return m_retries_per_frame; }
+    void reset_histograms();
+
+private:
+    struct Subscriber
+    {
+        std::shared_ptr<LiveViewFrameRing> ring;
+        std::size_t frames; // ring capacity plus the frames its consumer holds
+    };
+    using SubscriberList = std::vector<Subscriber>;
+
+    SCRSDK::CrError update_buffer_size();
+    void run();
+    // Returns the fill of the fullest ring before the push, 0 to 1
+    double publish(LiveViewFrame* frame);
+
+private:
+    SCRSDK::CrDeviceHandle m_device_handle;
+    bool m_open;
+    std::int32_t m_camera;
+    LiveViewFramePool m_pool;
+    std::atomic<std::uint64_t> m_fetched;
+    std::atomic<std::uint64_t> m_not_updated;
+    std::atomic<std::uint64_t> m_memory_insufficient;
+    std::atomic<std::uint64_t> m_pool_exhausted;
+    std::atomic<std::uint64_t> m_fetch_failed;
+    std::atomic<std::uint64_t> m_invalid_frames;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    std::atomic<int> m_cpu;
+    std::atomic<bool> m_pinned;
+    LiveViewPoller m_poller;
+    LiveViewGovernor m_governor;
+
+    LatencyHistogram m_fetch_latency;
+    LatencyHistogram m_frame_interval;
+    LatencyHistogram m_retries_per_frame;
+
+    // Copy-on-write list, replaced under m_subscribers_mtx and read by the fetch thread with atomic_load
+    std::shared_ptr<SubscriberList const> m_subscribers;
+    std::mutex m_subscribers_mtx;
+    std::size_t m_subscribed_frames; // sum of Subscriber::frames, under m_subscribers_mtx
+    // Held by the fetch thread while it pushes to the rings, unsubscribe() takes it
+    // to know no push through an old list snapshot is still in flight
+    std::mutex m_publish_mtx;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWSTREAM_H
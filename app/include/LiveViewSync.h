@@ -0,0 +1,138 @@
+#ifndef LIVEVIEWSYNC_H
+#define LIVEVIEWSYNC_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "LiveViewMultiplexer.h"
+
+namespace cli
+{
+
+// Frame count since 00:00:00:00 of a SMPTE 12M time code as reported by
+// CrImageDataBlock::GetTimeCode(): BCD hours, minutes, seconds and frames from the
+// most to the least significant byte, flag bits masked, bit 6 of the frames byte
+// set for drop-frame. fps is the nominal rate (24, 25, 30, 50, 60).
+// Returns -1 for a time code which is not valid BCD or exceeds fps.
+std::int64_t time_code_to_frames(CrInt32u time_code, std::uint32_t fps);
+
+// Frames in a day of time code, where it wraps back to zero
+std::int64_t time_code_day_frames(std::uint32_t fps, bool drop_frame);
+
+struct LiveViewSyncConfig
+{
+    std::uint32_t fps;          // nominal time code rate
+    std::uint32_t tolerance;    // frames by which the time codes of one set may differ
+    std::size_t max_buffered;   // frames held per camera while waiting for the others
+
+    LiveViewSyncConfig()
+        : fps(30)
+        , tolerance(0)
+        , max_buffered(8)
+    {}
+};
+
+// One frame per camera whose time codes match within the tolerance
+struct LiveViewSyncSet
+{
+    static constexpr std::size_t MaxCameras = 16;
+
+    std::size_t count;
+    std::int64_t time_code;                // frame count of the newest frame in the set
+    LiveViewFrame* frames[MaxCameras];     // ordered as the cameras were first seen, LiveViewFrame::camera tells which
+
+    LiveViewSyncSet()
+        : count(0)
+        , time_code(0)
+        , frames()
+    {}
+};
+
+struct LiveViewSyncStats
+{
+    std::int32_t camera;
+    std::size_t buffered;
+    std::uint64_t received;
+    std::uint64_t matched;
+    std::uint64_t stale;              // dropped, no other camera had a matching time code
+    std::uint64_t overflow;           // dropped, buffer full while another camera stalled
+    std::uint64_t invalid_time_code;
+    double offset_frames;             // mean time code difference to the first camera in matched sets
+    double skew_us;                   // mean arrival time difference to the first camera in matched sets
+    std::int64_t skew_min_us;
+    std::int64_t skew_max_us;
+    double drift_ppm;                 // time code clock against the host clock, least squares
+};
+
+// Time code alignment of the cameras of a LiveViewMultiplexer.
+// next() drains the merged stream into a bounded buffer per camera and emits a set as soon as
+// every camera of the multiplexer has a frame within tolerance of the newest buffered head.
+// Heads too old to ever match are dropped, and a camera which stalls only makes the others
+// lose their oldest frames, so memory stays at max_buffered frames per camera.
+// Not thread-safe: next(), reset() and stats() belong to the consumer thread of the multiplexer.
+class LiveViewSync
+{
+public:
+    static constexpr std::size_t MaxBuffered = 32;
+
+    explicit LiveViewSync(LiveViewMultiplexer& mux, LiveViewSyncConfig const& config = LiveViewSyncConfig());
+    ~LiveViewSync();
+
+    LiveViewSync(LiveViewSync const&) = delete;
+    LiveViewSync& operator=(LiveViewSync const&) = delete;
+
+    // Wait up to timeout for the next matched set. On success the caller owns the frames and must release(set).
+    bool next(LiveViewSyncSet& set, std::chrono::milliseconds timeout);
+    static void release(LiveViewSyncSet& set);
+
+    // Drop every buffered frame and the statistics
+    void reset();
+
+    std::vector<LiveViewSyncStats> stats() const;
+    std::uint64_t sets() const { return m_sets; }
+
+private:
+    struct Channel
+    {
+        std::int32_t camera; // 0: unused
+        LiveViewFrame* frames[MaxBuffered];
+        std::int64_t time_codes[MaxBuffered];
+        std::size_t head;
+        std::size_t count;
+
+        std::uint64_t received;
+        std::uint64_t matched;
+        std::uint64_t stale;
+        std::uint64_t overflow;
+        std::uint64_t invalid_time_code;
+        double offset_sum;
+        double skew_sum;
+        std::int64_t skew_min;
+        std::int64_t skew_max;
+
+        // Least squares of (time code - host time) over host time, both in seconds since the first frame
+        std::chrono::steady_clock::time_point first_host;
+        std::int64_t first_time_code;
+        double n, sx, sy, sxx, sxy;
+    };
+
+    void accept(LiveViewFrame* frame);
+    bool match(LiveViewSyncSet& set);
+    Channel* channel_of(std::int32_t camera);
+    void drop_head(Channel& channel);
+    void clear(Channel& channel);
+    std::int64_t distance(std::int64_t from, std::int64_t to) const;
+    double seconds_of(std::int64_t frames) const;
+
+private:
+    LiveViewMultiplexer& m_mux;
+    LiveViewSyncConfig m_config;
+    bool m_drop_frame;          // of the latest time code
+    std::int64_t m_day_frames;
+    Channel m_channels[LiveViewSyncSet::MaxCameras];
+    std::uint64_t m_sets;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWSYNC_H
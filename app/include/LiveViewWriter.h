@@ -0,0 +1,117 @@
+#ifndef LIVEVIEWWRITER_H
+#define LIVEVIEWWRITER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "LatencyHistogram.h"
+#include "LiveViewContainer.h"
+#include "LiveViewStream.h"
+#include "Text.h"
+
+namespace cli
+{
+
+enum class LiveViewWriteMode
+{
+    NumberedFiles, // <path>/LiveView000000.JPG, LiveView000001.JPG, ...
+    AppendFile,    // all frames appended to <path>, back-to-back JPEGs
+    Container      // indexed capture container at <path>, see LiveViewContainer.h
+};
+
+enum class LiveViewSyncPolicy
+{
+    None,       // leave it to the OS write-back
+    EveryBatch, // fsync after every batch of frames
+    Interval    // fsync at most every sync_interval
+};
+
+struct LiveViewWriterConfig
+{
+    LiveViewWriteMode mode;
+    text path;
+    LiveViewSyncPolicy sync;
+    std::chrono::milliseconds sync_interval;
+    std::size_t ring_capacity; // frames buffered while the disk is busy
+    std::size_t max_batch;     // frames coalesced into one write
+
+    LiveViewWriterConfig()
+        : mode(LiveViewWriteMode::NumberedFiles)
+        , path()
+        , sync(LiveViewSyncPolicy::None)
+        , sync_interval(1000)
+        , ring_capacity(8)
+        , max_batch(8)
+    {}
+};
+
+// Writes live-view frames to disk from its own thread.
+// Frames are taken from a LiveViewStream subscription, so the fetch path never waits
+// on the filesystem: when the disk falls behind the ring drops the oldest frames.
+// In AppendFile and Container modes every batch of queued frames is written with a single gathered write.
+class LiveViewWriter
+{
+public:
+    LiveViewWriter();
+    ~LiveViewWriter();
+
+    LiveViewWriter(LiveViewWriter const&) = delete;
+    LiveViewWriter& operator=(LiveViewWriter const&) = delete;
+
+    bool start(LiveViewStream& stream, LiveViewWriterConfig const& config);
+    void stop();
+    bool is_running() const { return m_running.load(std::memory_order_acquire); }
+
+    std::uint64_t frames_written() const { return m_frames_written.load(std::memory_order_relaxed); }
+    std::uint64_t bytes_written() const { return m_bytes_written.load(std::memory_order_relaxed); }
+    std::uint64_t batches() const { return m_batches.load(std::memory_order_relaxed); }
+    std::uint64_t syncs() const { return m_syncs.load(std::memory_order_relaxed); }
+    std::uint64_t write_errors() const { return m_write_errors.load(std::memory_order_relaxed); }
+    // Stopped on its own after a write to the file failed; the file was closed with the frames written before
+    bool failed() const { return m_failed.load(std::memory_order_relaxed); }
+    std::uint64_t dropped() const;
+    // Frame fetch to the end of its write, microseconds
+    LatencyHistogram const& write_age() const { return m_write_age; }
+    void reset_histograms() { m_write_age.reset(); }
+
+private:
+    void run();
+    bool write_batch(LiveViewFrame** frames, std::size_t count);
+    bool write_numbered(LiveViewFrame* frame);
+    bool write_container(LiveViewFrame** frames, std::size_t count);
+    bool write_container_index();
+    // Container index and footer, sync and close
+    void finish_file();
+    bool sync_due(bool batch_end);
+
+private:
+    LiveViewStream* m_stream;
+    LiveViewWriterConfig m_config;
+    std::shared_ptr<LiveViewFrameRing> m_ring;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    int m_fd; // AppendFile and Container modes
+    std::uint32_t m_file_no; // NumberedFiles mode
+    // Container mode
+    std::uint64_t m_offset;
+    std::chrono::steady_clock::time_point m_start_time;
+    std::vector<lvc::IndexEntry> m_index;
+    std::chrono::steady_clock::time_point m_last_sync;
+
+    std::atomic<std::uint64_t> m_frames_written;
+    std::atomic<std::uint64_t> m_bytes_written;
+    std::atomic<std::uint64_t> m_batches;
+    std::atomic<std::uint64_t> m_syncs;
+    std::atomic<std::uint64_t> m_write_errors;
+    std::atomic<bool> m_failed;
+    std::uint64_t m_dropped_before; // drops of the previous ring
+    LatencyHistogram m_write_age;
+};
+
+} // namespace cli
+
+#endif // !LIVEVIEWWRITER_H
@@ -0,0 +1,46 @@
+#ifndef PROPERTYBATCH_H
+#define PROPERTYBATCH_H
+
+#include <vector>
+#include "CrTypes.h"
+
+namespace cli
+{
+
+enum class PropertyAssignmentResult
+{
+    Pending,        // sent, not confirmed yet
+    Confirmed,      // the camera reports the value
+    Unsupported,    // not reported by the camera, or a string property
+    NotWritable,
+    Rejected,       // SetDeviceProperty() failed
+    TimedOut,       // sent, but the camera did not report the value in time
+};
+
+// One property of a batch, applied by CameraDevice::apply_properties()
+struct PropertyAssignment
+{
+    CrInt32u code;
+    CrInt64u value;
+    PropertyAssignmentResult result;
+
+    PropertyAssignment(CrInt32u code_, CrInt64u value_)
+        : code(code_)
+        , value(value_)
+        , result(PropertyAssignmentResult::Pending)
+    {}
+};
+
+// Order in which a batch is applied: a property can only take effect once the properties
+// of earlier stages are set, e.g. the shutter speed after the exposure program.
+// Properties of one stage do not depend on each other.
+int property_stage(CrInt32u code);
+
+// Stable sort by property_stage(), assignments of the same code collapse to the last one
+void order_assignments(std::vector<PropertyAssignment>& batch);
+
+char const* format_assignment_result(PropertyAssignmentResult result);
+
+} // namespace cli
+
+#endif // !PROPERTYBATCH_H
@@ -0,0 +1,66 @@
+#ifndef PROPERTYCHANGEQUEUE_H
+#define PROPERTYCHANGEQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "CrTypes.h"
+
+namespace cli
+{
+
+// Property codes changed since the PropertyValueTable was last refreshed.
+// OnPropertyChangedCodes() pushes on the SDK callback thread; the thread owning the
+// table takes the batch and refreshes only those codes with GetSelectDeviceProperties(),
+// or nothing at all when no property changed. The queue starts out invalid, so the first
+// take() asks for a full GetDeviceProperties() load.
+// Threads waiting for the camera to confirm a setting block in wait_push() until the next batch.
+class PropertyChangeQueue
+{
+public:
+    // More distinct codes than this and a full load is cheaper
+    static constexpr std::size_t MaxPending = 128;
+
+    enum class Refresh
+    {
+        None,   // the table is current
+        Codes,  // reload the returned codes
+        All,    // reload every property
+    };
+
+    PropertyChangeQueue();
+
+    PropertyChangeQueue(PropertyChangeQueue const&) = delete;
+    PropertyChangeQueue& operator=(PropertyChangeQueue const&) = delete;
+
+    // Callback thread
+    void push(CrInt32u num, CrInt32u const* codes);
+
+    // Everything has to be reloaded, e.g. after a reconnect or a failed refresh
+    void invalidate();
+
+    // Owner thread: take the pending batch, codes is sorted and free of duplicates.
+    // The queue counts as current afterwards; codes pushed meanwhile form the next batch.
+    Refresh take(std::vector<CrInt32u>& codes);
+
+    // Any thread: batches pushed so far
+    std::uint64_t generation() const { return m_generation.load(std::memory_order_acquire); }
+    // Wait until a batch is pushed after generation was read, false when deadline passes first
+    bool wait_push(std::uint64_t generation, std::chrono::steady_clock::time_point deadline);
+
+private:
+    std::mutex m_mtx;
+    std::condition_variable m_pushed;
+    std::vector<CrInt32u> m_pending;
+    std::atomic<std::uint64_t> m_generation;
+    bool m_invalid;
+    // Lets take() skip the lock while nothing changed
+    std::atomic<bool> m_dirty;
+};
+
+} // namespace cli
+
+#endif // !PROPERTYCHANGEQUEUE_H
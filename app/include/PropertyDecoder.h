@@ -0,0 +1,22 @@
+#ifndef PROPERTYDECODER_H
+#define PROPERTYDECODER_H
+
+#include <cstddef>
+#include "CameraRemote_SDK.h"
+#include "PropertyValueTable.h"
+
+namespace cli
+{
+
+// Decode one entry of a GetDeviceProperties() or GetSelectDeviceProperties() list into table.
+// The code indexes a compile-time table which holds, per property, the PropertyValueTable
+// member (and so its element type) and its parse_* function; there is no switch to extend.
+// Returns false for codes without an entry, which leave table untouched.
+bool decode_property(PropertyValueTable& table, SCRSDK::CrDeviceProperty& prop);
+
+// Codes with an entry in the table
+std::size_t decoded_property_count();
+
+} // namespace cli
+
+#endif // !PROPERTYDECODER_H
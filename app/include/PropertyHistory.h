@@ -0,0 +1,87 @@
+#ifndef PROPERTYHISTORY_H
+#define PROPERTYHISTORY_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "CrDeviceProperty.h"
+
+namespace cli
+{
+
+// One change of a property's current value
+struct PropertyChange
+{
+    std::chrono::steady_clock::time_point time; // reported by OnPropertyChangedCodes(), or loaded without a report
+    CrInt64u old_value;
+    CrInt64u new_value;
+    CrInt32u code;
+    bool own;                   // followed a set_property() of the same code
+    std::int64_t apply_us;      // own: set_property() to the report, microseconds; otherwise -1
+};
+
+// The last Capacity property changes of one camera.
+// OnPropertyChangedCodes() only stamps the report time of each code, an atomic store per code.
+// The PropertySubscriptions worker fetches the reported codes as they come in, whatever the
+// menu thread does, and hands every property it fetches to loaded(), which records a change
+// when the current value differs from the previously fetched one. set_property() notes its
+// code first, so the change which follows is marked as our own together with how long the
+// camera took to report it.
+// Limit: the worker fetches a burst of reports once its coalescing window has passed
+// (PropertySubscriptions::DefaultCoalesce), so changes of one code within a window, e.g.
+// ISO 100 -> 200 -> 400, are recorded as a single 100 -> 400 stamped with the first report.
+// A full reload is compared with the previous values like any refresh.
+// Nothing allocates after construction. String properties are not recorded.
+class PropertyHistory
+{
+public:
+    static constexpr std::size_t Capacity = 1024;
+    // Writes awaiting their change, the oldest is forgotten first
+    static constexpr std::size_t MaxWrites = 32;
+    // A write the camera did not answer within this is taken as ignored
+    static constexpr std::chrono::seconds WriteWindow{ 10 };
+    static constexpr CrInt32u AnyCode = SCRSDK::CrDeviceProperty_Undefined;
+
+    PropertyHistory();
+
+    PropertyHistory(PropertyHistory const&) = delete;
+    PropertyHistory& operator=(PropertyHistory const&) = delete;
+
+    // Callback thread, lock-free
+    void reported(CrInt32u num, CrInt32u const* codes);
+
+    // Before sending code to the camera, and after the camera refused it
+    void wrote(CrInt32u code);
+    void write_failed(CrInt32u code);
+
+    // Property worker: a property as just fetched; known tells whether old_value was fetched before
+    void loaded(CrInt32u code, bool known, CrInt64u old_value, CrInt64u new_value);
+
+    // Any thread: copy up to max of the newest changes of code, or of every property, newest first
+    std::size_t recent(PropertyChange* out, std::size_t max, CrInt32u code = AnyCode) const;
+    // Changes recorded so far, including those already overwritten
+    std::uint64_t recorded() const;
+
+private:
+    struct Write
+    {
+        std::chrono::steady_clock::time_point time;
+        CrInt32u code; // AnyCode: free
+    };
+
+    using ticks = std::chrono::steady_clock::duration::rep;
+
+    // Report time of every code below CrDeviceProperty_MaxVal since it was last loaded, 0: none
+    std::atomic<ticks> m_reported[SCRSDK::CrDeviceProperty_MaxVal];
+
+    mutable std::mutex m_mtx;
+    PropertyChange m_ring[Capacity];
+    std::uint64_t m_recorded;
+    Write m_writes[MaxWrites];
+};
+
+} // namespace cli
+
+#endif // !PROPERTYHISTORY_H
@@ -0,0 +1,80 @@
+#ifndef PROPERTYREGISTRY_H
+#define PROPERTYREGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CameraRemote_SDK.h"
+#include "Text.h"
+
+namespace cli
+{
+
+// One device property as last reported by the camera, whatever its code
+struct PropertyRecord
+{
+    CrInt64u current;
+    CrInt32u code;
+    CrInt32u values_offset;     // into the value pool of the registry
+    CrInt32u values_size;       // bytes; for CrDataType_STR the current string in UTF-16 units
+    CrInt32u values_capacity;   // bytes reserved at values_offset
+    CrInt16u type;              // SCRSDK::CrDataType
+    CrInt16 enable_flag;        // SCRSDK::CrPropertyEnableFlag
+    CrInt16u variable_flag;     // SCRSDK::CrPropertyVariableFlag
+    bool readable;              // IsGetEnableCurrentValue()
+    bool writable;              // IsSetEnableCurrentValue()
+    bool reported;              // by the full load in progress, see mark_unreported()
+};
+
+// Type-erased store of every property in GetDeviceProperties() and GetSelectDeviceProperties() lists.
+// Records sit in one vector in the order the codes were first reported and their possible
+// values in one byte pool, so iterating all of them touches two contiguous buffers.
+// find() is a dense index lookup on the code. A record whose value list grows moves
+// to the end of the pool, which is compacted once more than half of it is stale.
+// Not thread-safe, updated and read by the thread which loads the properties.
+class PropertyRegistry
+{
+public:
+    PropertyRegistry();
+
+    // Forget every property
+    void clear();
+    void update(SCRSDK::CrDeviceProperty& prop);
+    // A full load keeps the previous values to compare with: mark every record before
+    // updating from the full list, then drop those the list did not report
+    void mark_unreported();
+    void remove_unreported();
+
+    PropertyRecord const* find(CrInt32u code) const;
+
+    std::size_t size() const { return m_records.size(); }
+    PropertyRecord const* begin() const { return m_records.data(); }
+    PropertyRecord const* end() const { return m_records.data() + m_records.size(); }
+
+    // Possible values, element_size(type) bytes each; a range type holds min, max and step
+    CrInt8u const* values(PropertyRecord const& record) const { return m_pool.data() + record.values_offset; }
+    std::size_t value_count(PropertyRecord const& record) const;
+    // Sign- or zero-extended per the type, the low 64 bits of 128-bit values
+    CrInt64 value_at(PropertyRecord const& record, std::size_t index) const;
+    // Current value of a CrDataType_STR property
+    text current_text(PropertyRecord const& record) const;
+
+    // Bytes per value of a CrDataType, 0 for strings and undefined types
+    static std::size_t element_size(CrInt16u type);
+
+private:
+    void store_values(PropertyRecord& record, CrInt8u const* data, CrInt32u size);
+    void compact();
+
+private:
+    static constexpr CrInt32u const NoRecord = 0xFFFF;
+
+    std::vector<CrInt16u> m_index; // code to position in m_records, NoRecord: none
+    std::vector<PropertyRecord> m_records;
+    std::vector<CrInt8u> m_pool;
+    std::size_t m_stale;           // pool bytes no record refers to
+};
+
+} // namespace cli
+
+#endif // !PROPERTYREGISTRY_H
@@ -0,0 +1,49 @@
+#ifndef PROPERTYSNAPSHOT_H
+#define PROPERTYSNAPSHOT_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "PropertyValueTable.h"
+
+namespace cli
+{
+
+// One published version of the property table, never modified once published
+struct PropertySnapshot
+{
+    std::uint64_t version;                          // publications so far, 0: nothing loaded yet
+    std::chrono::steady_clock::time_point loaded;   // when the table was published
+    PropertyValueTable table;
+};
+
+// Read-copy-update of a PropertyValueTable.
+// The thread loading properties decodes into its own working table and publishes a copy;
+// any other thread takes the current snapshot with a single atomic_load and keeps a
+// consistent view for as long as it holds the pointer. Readers never lock and never see
+// a half-decoded table, and a slow reader does not hold up the next refresh.
+// The old version is freed when its last reader lets go.
+class PropertySnapshotBuffer
+{
+public:
+    PropertySnapshotBuffer();
+
+    PropertySnapshotBuffer(PropertySnapshotBuffer const&) = delete;
+    PropertySnapshotBuffer& operator=(PropertySnapshotBuffer const&) = delete;
+
+    // Any thread
+    std::shared_ptr<PropertySnapshot const> load() const { return std::atomic_load(&m_current); }
+    std::uint64_t version() const { return load()->version; }
+
+    // Writer: copy table into a new version and make it current
+    void publish(PropertyValueTable const& table);
+
+private:
+    std::shared_ptr<PropertySnapshot const> m_current;
+    std::mutex m_publish_mtx; // orders concurrent writers, readers never take it
+};
+
+} // namespace cli
+
+#endif // !PROPERTYSNAPSHOT_H
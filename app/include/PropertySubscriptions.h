@@ -0,0 +1,150 @@
+#ifndef PROPERTYSUBSCRIPTIONS_H
+#define PROPERTYSUBSCRIPTIONS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "CameraRemote_SDK.h"
+#include "PropertyChangeQueue.h"
+#include "PropertyHistory.h"
+#include "PropertyRegistry.h"
+#include "PropertySnapshot.h"
+
+namespace cli
+{
+
+// A change of one subscribed property
+struct PropertyEvent
+{
+    CrInt32u code;
+    CrInt16u type;          // SCRSDK::CrDataType
+    CrInt64u old_value;     // new_value when initial
+    CrInt64u new_value;
+    bool initial;           // first value after subscribing, not a change
+};
+
+using PropertySubscriber = std::function<void(PropertyEvent const&)>;
+
+// Follows the properties of the camera on a worker thread of its own, whatever the menu thread does.
+// changed() is all the SDK callback does: it queues the codes and returns, no subscriber
+// ever runs on the callback thread. The worker lets a burst of reports settle for the
+// coalescing window, fetches the reported codes with one GetSelectDeviceProperties(),
+// or all of them with GetDeviceProperties() after invalidate(), and decodes them once into
+// its own PropertyRegistry and PropertyValueTable. Every fetched value goes to the
+// PropertyHistory, the table is then published as a PropertySnapshot, and every subscriber
+// of a code whose value actually changed is called.
+// Each subscriber first gets the current value as an initial event. String properties are not delivered.
+// The worker runs while the device is open.
+class PropertySubscriptions
+{
+public:
+    using Id = std::uint64_t;
+
+    static constexpr std::chrono::milliseconds DefaultCoalesce{ 20 };
+
+    // history, if any, records the changes of every fetched property
+    explicit PropertySubscriptions(PropertyHistory* history = nullptr);
+    ~PropertySubscriptions();
+
+    PropertySubscriptions(PropertySubscriptions const&) = delete;
+    PropertySubscriptions& operator=(PropertySubscriptions const&) = delete;
+
+    // Fetch from a connected device, close() before the handle is released.
+    // Neither may be called from a subscriber.
+    void open(SCRSDK::CrDeviceHandle device_handle);
+    void close();
+    bool is_running() const { return m_running.load(std::memory_order_acquire); }
+
+    // Any thread, subscribers included. callback runs on the worker thread and must not throw,
+    // an exception escaping it ends the program like on any other thread.
+    Id subscribe(CrInt32u code, PropertySubscriber callback);
+    // Old and new value converted to T, e.g. CrInt16u for SCRSDK::CrRecordingState
+    template <typename T>
+    Id subscribe_value(CrInt32u code, std::function<void(T old_value, T new_value)> callback)
+    {
+        return subscribe(code, [callback](PropertyEvent const& event) {
+            callback(static_cast<T>(event.old_value), static_cast<T>(event.new_value));
+        });
+    }
+    // Once it returns the callback is not running and never runs again,
+    // except when a subscriber unsubscribes itself while it runs
+    void unsubscribe(Id id);
+
+    // SDK callback thread
+    void changed(CrInt32u num, CrInt32u const* codes) { m_changes.push(num, codes); }
+    // Fetch every subscribed code again, e.g. after a reconnect
+    void invalidate() { m_changes.invalidate(); }
+
+    // How long a burst of reports may take before it is fetched
+    void set_coalesce(std::chrono::milliseconds window) { m_coalesce.store(window.count(), std::memory_order_relaxed); }
+
+    // Any thread: the property table as of the latest fetch, consistent and never modified
+    std::shared_ptr<PropertySnapshot const> snapshot() const { return m_snapshot.load(); }
+
+    std::uint64_t fetches() const { return m_fetches.load(std::memory_order_relaxed); }
+    std::uint64_t delivered() const { return m_delivered.load(std::memory_order_relaxed); }
+
+private:
+    struct Subscriber
+    {
+        PropertySubscriber callback;
+        std::atomic<bool> active;   // cleared by unsubscribe(), checked under m_dispatch_mtx
+        // Worker thread only
+        bool primed;                // got its initial value
+        bool requeued;              // its code was fetched again once for lack of a value
+    };
+
+    struct Subscription
+    {
+        Id id;
+        CrInt32u code;
+        std::shared_ptr<Subscriber> subscriber;
+    };
+    using SubscriptionList = std::vector<Subscription>;
+
+    void start();
+    void stop();
+    void run();
+    // Fetch codes, or every property when all is set, publish the table and deliver what changed
+    bool fetch(SubscriptionList const& subscriptions, std::vector<CrInt32u>& codes, bool all);
+    // Initial value to every subscription which has none yet
+    void prime(SubscriptionList const& subscriptions);
+    void deliver(Subscription const& subscription, PropertyEvent const& event);
+
+private:
+    SCRSDK::CrDeviceHandle m_device_handle;
+    std::thread m_thread;
+    std::atomic<std::thread::id> m_worker_id;
+    std::atomic<bool> m_running;
+    std::mutex m_control_mtx;   // m_device_handle and starting the worker
+
+    // Copy-on-write list, replaced under m_subscriptions_mtx and read by the worker with atomic_load
+    std::shared_ptr<SubscriptionList const> m_subscriptions;
+    std::mutex m_subscriptions_mtx;
+    Id m_next_id;
+    // Held while subscribers run, so unsubscribe() can wait for a running one
+    std::mutex m_dispatch_mtx;
+
+    PropertyChangeQueue m_changes;
+    std::atomic<std::int64_t> m_coalesce; // milliseconds
+
+    PropertyHistory* m_history;
+
+    // Worker thread only
+    PropertyRegistry m_registry;
+    PropertyValueTable m_table;
+    std::vector<CrInt32u> m_codes;
+
+    PropertySnapshotBuffer m_snapshot;
+    std::atomic<std::uint64_t> m_fetches;
+    std::atomic<std::uint64_t> m_delivered;
+};
+
+} // namespace cli
+
+#endif // !PROPERTYSUBSCRIPTIONS_H
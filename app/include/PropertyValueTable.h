@@ -1,9 +1,11 @@
 ﻿#ifndef PROPERTYVALUETABLE_H
 #define PROPERTYVALUETABLE_H
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 #include "CameraRemote_SDK.h"
+#include "SmallVector.h"
 #include "Text.h"
 
 namespace cli
@@ -11,16 +13,51 @@ namespace cli
 static const int MAX_CURRENT_STR = 255;
 
 
+// Read-only view of contiguous values, std::span<T const> is not available in C++17
+template <typename T>
+class ValueSpan
+{
+public:
+    ValueSpan()
+        : m_data(nullptr)
+        , m_size(0)
+    {}
+    ValueSpan(T const* data, std::size_t size)
+        : m_data(data)
+        , m_size(size)
+    {}
+
+    T const* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return 0 == m_size; }
+    T const* begin() const { return m_data; }
+    T const* end() const { return m_data + m_size; }
+    T const& operator[](std::size_t index) const { return m_data[index]; }
+
+private:
+    T const* m_data;
+    std::size_t m_size;
+};
+
+// Possible values of a property. Most lists are a few toggles or states and stay inside
+// the table; only long ones such as ISO or shutter speed go to the heap.
+constexpr std::size_t PossibleValuesInlineBytes = 16;
+template <typename T>
+using PossibleValues = SmallVector<T, (sizeof(T) < PossibleValuesInlineBytes) ? PossibleValuesInlineBytes / sizeof(T) : 1>;
+
 template <typename T>
 struct PropertyValueEntry
 {
     int writable; // -1:Initial, 0:false, 1:true
     T current;
-    std::vector<T> possible;
+    PossibleValues<T> possible;
     PropertyValueEntry()
     {
         writable = -1;
     }
+
+    // Valid until the entry is decoded again
+    ValueSpan<T> values() const { return ValueSpan<T>(possible.data(), possible.size()); }
 };
 
 struct PropertyStringValueEntry
@@ -112,113 +149,149 @@ struct PropertyValueTable
     PropertyValueEntry<std::uint8_t>  media_slot3_recording_available_type;
 };
 
-std::vector<std::uint16_t> parse_f_number(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint32_t> parse_iso_sensitivity(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint32_t> parse_shutter_speed(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_position_key_setting(unsigned char const * buf, std::uint32_t nval);
-std::vector<std::uint32_t> parse_exposure_program_mode(unsigned char const * buf, std::uint32_t nval);
-std::vector<std::uint32_t> parse_still_capture_mode(unsigned char const * buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_focus_mode(unsigned char const * buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_focus_area(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_live_view_image_quality(unsigned char const * buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_media_slotx_format_enable_status(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_white_balance(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_customwb_capture_standby(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_customwb_capture_standby_cancel(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_customwb_capture_operation(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_customwb_capture_execution_state(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_zoom_operation_status(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_zoom_setting_type(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_zoom_types_status(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::int8_t> parse_zoom_operation(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::int8_t> parse_zoom_speed_range(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_save_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_load_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_remocon_zoom_speed_type(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_gain_base_sensitivity(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_gain_base_iso_sensitivity(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_monitor_lut_setting(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_exposure_index(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_baselook_value(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_playback_media(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_iris_mode_setting(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_shutter_mode_setting(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_gain_control_setting(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_exposure_control_type(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_recording_setting(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint32_t> parse_dispmode_candidate(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint32_t> parse_dispmode_setting(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_dispmode(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::int8_t> parse_gain_db_value(unsigned char const* buf, std::int32_t nval);
-std::vector<std::int8_t> parse_white_balance_tint(unsigned char const* buf, std::int32_t nval);
-std::vector<std::int16_t> parse_white_balance_tint_step(unsigned char const* buf, std::int32_t nval);
-std::vector<std::uint64_t> parse_shutter_speed_value(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_focus_bracket_shot_num(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_focus_bracket_focus_range(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_movie_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_silent_mode(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_silent_mode_aperture_drive_in_af(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_silent_mode_shutter_when_power_off(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_silent_mode_auto_pixel_mapping(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_shutter_type(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_movie_shooting_mode(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint16_t> parse_focus_position(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_focus_driving_status(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint32_t> parse_zoom_distance(unsigned char const* buf, std::uint32_t nval);
-std::vector<std::uint8_t> parse_slotx_rec_available(unsigned char const* buf, std::uint32_t nval);
-
-
-text format_f_number(std::uint16_t f_number);
-text format_iso_sensitivity(std::uint32_t iso);
-text format_shutter_speed(std::uint32_t shutter_speed);
-text format_position_key_setting(std::uint16_t position_key_setting);
-text format_exposure_program_mode(std::uint32_t exposure_program_mode);
-text format_still_capture_mode(std::uint32_t still_capture_mode);
-text format_focus_mode(std::uint16_t focus_mode);
-text format_focus_area(std::uint16_t focus_area);
-text format_live_view_image_quality(std::uint16_t focus_mode);
-text format_media_slotx_format_enable_status(std::uint8_t media_slotx_format_enable_status);
-text format_white_balance(std::uint16_t value);
-text format_customwb_capture_standby(std::uint16_t customwb_capture_standby);
-text format_customwb_capture_standby_cancel(std::uint16_t customwb_capture_standby_cancel);
-text format_customwb_capture_operation(std::uint16_t customwb_capture_operation);
-text format_customwb_capture_execution_state(std::uint16_t customwb_capture_execution_state);
-text format_zoom_operation_status(std::uint8_t zoom_operation_status);
-text format_zoom_setting_type(std::uint8_t zoom_setting_type);
-text format_zoom_types_status(std::uint8_t zoom_types_status);
-text format_remocon_zoom_speed_type(std::uint8_t remocon_zoom_speed_type);
-text format_aps_c_or_full_switching_setting(std::uint8_t aps_c_or_full_switching);
-text format_aps_c_or_full_switching_enable_status(std::uint8_t aps_c_or_full_switching_enable_status);
-text format_camera_setting_save_operation(std::uint16_t camera_setting_save_operation);
-text format_camera_setting_read_operation(std::uint16_t camera_setting_save_operation);
-text format_camera_setting_save_read_state(std::uint8_t customwb_capture_execution_state);
-text format_camera_setting_reset_enable_status(std::uint8_t camera_setting_reset_enable_status);
-text format_gain_base_sensitivity(std::uint8_t gain_base);
-text format_gain_base_iso_sensitivity(std::uint8_t gain_base_iso);
-text format_monitor_lut_setting(std::uint8_t body_key_lock);
-text format_baselook_value(std::uint8_t baselook_value);
-text format_playback_media(std::uint8_t playback_media);
-text format_shutter_mode_setting(std::uint8_t shutter_mode_setting);
-text format_iris_mode_setting(std::uint8_t iris_mode_setting);
-text format_exposure_control_type(std::uint8_t exposure_control_type);
-text format_gain_control_setting(std::uint8_t gain_control_setting);
-text format_recording_setting(std::uint16_t recording_setting);
-text format_dispmode(std::uint8_t dispmode);
-text format_movie_rec_button_toggle_enable_status(std::uint8_t movie_rec_button_toggle_enable_status);
-text format_shutter_speed_value(std::uint64_t shutter_speed_value);
-text format_media_slotx_status(std::uint8_t media_slotx_status);
-text format_image_stabilization_steady_shot(std::uint8_t image_stabilization_steady_shot);
-text format_movie_image_stabilization_steady_shot(std::uint8_t movie_image_stabilization_steady_shot);
-text format_silent_mode(std::uint8_t silent_mode);
-text format_silent_mode_aperture_drive_in_af(std::uint8_t aperture_drive_in_af);
-text format_silent_mode_shutter_when_power_off(std::uint8_t when_power_off);
-text format_silent_mode_auto_pixel_mapping(std::uint8_t auto_pixel_mapping);
-text format_shutter_type(std::uint8_t shutter_type);
-text format_movie_shooting_mode(std::uint16_t movie_shooting_mode);
-text format_focus_driving_status(std::uint8_t focus_driving_status);
-text format_media_slotx_rec_available(std::uint8_t rec_available);
-text format_monitoring_is_delivery(std::uint8_t sts);
+void parse_f_number(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_iso_sensitivity(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values);
+void parse_shutter_speed(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values);
+void parse_position_key_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_exposure_program_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values);
+void parse_still_capture_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values);
+void parse_focus_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_focus_area(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_live_view_image_quality(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_media_slotx_format_enable_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_white_balance(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_customwb_capture_standby(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_customwb_capture_standby_cancel(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_customwb_capture_operation(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_customwb_capture_execution_state(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_zoom_operation_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_zoom_setting_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_zoom_types_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_zoom_operation(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values);
+void parse_zoom_speed_range(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values);
+void parse_save_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_load_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_remocon_zoom_speed_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_gain_base_sensitivity(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_gain_base_iso_sensitivity(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_monitor_lut_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_exposure_index(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_baselook_value(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_playback_media(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_iris_mode_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_shutter_mode_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_gain_control_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_exposure_control_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_recording_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_dispmode_candidate(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values);
+void parse_dispmode_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values);
+void parse_dispmode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_gain_db_value(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values);
+void parse_white_balance_tint(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values);
+void parse_white_balance_tint_step(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int16_t>& values);
+void parse_shutter_speed_value(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint64_t>& values);
+void parse_focus_bracket_shot_num(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_focus_bracket_focus_range(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_movie_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_silent_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_silent_mode_aperture_drive_in_af(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_silent_mode_shutter_when_power_off(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_silent_mode_auto_pixel_mapping(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_shutter_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_movie_shooting_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_focus_position(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values);
+void parse_focus_driving_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+void parse_zoom_distance(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values);
+void parse_slotx_rec_available(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values);
+
+
+// Name of one value of an enumerated property
+struct ValueName
+{
+    std::uint32_t value;
+    text_view name;
+};
+
+// Short formatted value kept inside the object, so formatting does not allocate.
+// Longer text is cut at Capacity characters.
+class ValueText
+{
+public:
+    static constexpr std::size_t Capacity = 48;
+
+    ValueText()
+        : m_data()
+        , m_size(0)
+    {}
+
+    ValueText& append(text_view value);
+    ValueText& append(text_char value) { return append(text_view(&value, 1)); }
+    ValueText& append_number(std::uint64_t value);
+
+    text_view view() const { return text_view(m_data, m_size); }
+    operator text_view() const { return view(); }
+
+private:
+    text_char m_data[Capacity];
+    std::size_t m_size;
+};
+
+inline std::basic_ostream<text_char>& operator<<(std::basic_ostream<text_char>& os, ValueText const& value)
+{
+    return os << value.view();
+}
+
+ValueText format_f_number(std::uint16_t f_number);
+ValueText format_iso_sensitivity(std::uint32_t iso);
+ValueText format_shutter_speed(std::uint32_t shutter_speed);
+text_view format_position_key_setting(std::uint16_t position_key_setting);
+text_view format_exposure_program_mode(std::uint32_t exposure_program_mode);
+text_view format_still_capture_mode(std::uint32_t still_capture_mode);
+text_view format_focus_mode(std::uint16_t focus_mode);
+text_view format_focus_area(std::uint16_t focus_area);
+text_view format_live_view_image_quality(std::uint16_t focus_mode);
+text_view format_media_slotx_format_enable_status(std::uint8_t media_slotx_format_enable_status);
+text_view format_white_balance(std::uint16_t value);
+text_view format_customwb_capture_standby(std::uint16_t customwb_capture_standby);
+text_view format_customwb_capture_standby_cancel(std::uint16_t customwb_capture_standby_cancel);
+text_view format_customwb_capture_operation(std::uint16_t customwb_capture_operation);
+text_view format_customwb_capture_execution_state(std::uint16_t customwb_capture_execution_state);
+text_view format_zoom_operation_status(std::uint8_t zoom_operation_status);
+text_view format_zoom_setting_type(std::uint8_t zoom_setting_type);
+text_view format_zoom_types_status(std::uint8_t zoom_types_status);
+text_view format_remocon_zoom_speed_type(std::uint8_t remocon_zoom_speed_type);
+text_view format_aps_c_or_full_switching_setting(std::uint8_t aps_c_or_full_switching);
+text_view format_aps_c_or_full_switching_enable_status(std::uint8_t aps_c_or_full_switching_enable_status);
+text_view format_camera_setting_save_operation(std::uint16_t camera_setting_save_operation);
+text_view format_camera_setting_read_operation(std::uint16_t camera_setting_save_operation);
+text_view format_camera_setting_save_read_state(std::uint8_t customwb_capture_execution_state);
+text_view format_camera_setting_reset_enable_status(std::uint8_t camera_setting_reset_enable_status);
+text_view format_gain_base_sensitivity(std::uint8_t gain_base);
+text_view format_gain_base_iso_sensitivity(std::uint8_t gain_base_iso);
+text_view format_monitor_lut_setting(std::uint8_t body_key_lock);
+text_view format_baselook_value(std::uint8_t baselook_value);
+text_view format_playback_media(std::uint8_t playback_media);
+text_view format_shutter_mode_setting(std::uint8_t shutter_mode_setting);
+text_view format_iris_mode_setting(std::uint8_t iris_mode_setting);
+text_view format_exposure_control_type(std::uint8_t exposure_control_type);
+text_view format_gain_control_setting(std::uint8_t gain_control_setting);
+text_view format_recording_setting(std::uint16_t recording_setting);
+text_view format_dispmode(std::uint8_t dispmode);
+text_view format_movie_rec_button_toggle_enable_status(std::uint8_t movie_rec_button_toggle_enable_status);
+ValueText format_shutter_speed_value(std::uint64_t shutter_speed_value);
+text_view format_media_slotx_status(std::uint8_t media_slotx_status);
+text_view format_image_stabilization_steady_shot(std::uint8_t image_stabilization_steady_shot);
+text_view format_movie_image_stabilization_steady_shot(std::uint8_t movie_image_stabilization_steady_shot);
+text_view format_silent_mode(std::uint8_t silent_mode);
+text_view format_silent_mode_aperture_drive_in_af(std::uint8_t aperture_drive_in_af);
+text_view format_silent_mode_shutter_when_power_off(std::uint8_t when_power_off);
+text_view format_silent_mode_auto_pixel_mapping(std::uint8_t auto_pixel_mapping);
+text_view format_shutter_type(std::uint8_t shutter_type);
+text_view format_movie_shooting_mode(std::uint16_t movie_shooting_mode);
+text_view format_focus_driving_status(std::uint8_t focus_driving_status);
+text_view format_media_slotx_rec_available(std::uint8_t rec_available);
+text_view format_monitoring_is_delivery(std::uint8_t sts);
 
 } // namespace cli
 
@@ -0,0 +1,190 @@
+#ifndef SMALLVECTOR_H
+#define SMALLVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace cli
+{
+
+// Vector of trivially copyable values holding up to N of them inside the object itself.
+// Only a longer list goes to the heap, and that buffer is kept when the list shrinks again,
+// so refilling never allocates once the largest size has been seen.
+// Copying a list which fits inline is a memcpy without any allocation.
+template <typename T, std::size_t N>
+class SmallVector
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector copies its values with memcpy");
+    static_assert(0 < N, "SmallVector needs inline room for at least one value");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = T const*;
+
+    SmallVector()
+        : m_data(m_inline)
+        , m_size(0)
+        , m_capacity(static_cast<std::uint32_t>(N))
+    {}
+
+    SmallVector(SmallVector const& other)
+        : SmallVector()
+    {
+        assign(other.m_data, other.m_size);
+    }
+
+    SmallVector(SmallVector&& other) noexcept
+        : SmallVector()
+    {
+        take(other);
+    }
+
+    ~SmallVector()
+    {
+        release();
+    }
+
+    SmallVector& operator=(SmallVector const& other)
+    {
+        if (this != &other) {
+            assign(other.m_data, other.m_size);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    size_type size() const { return m_size; }
+    size_type capacity() const { return m_capacity; }
+    bool empty() const { return 0 == m_size; }
+    // Values live inside the object
+    bool is_inline() const { return m_data == m_inline; }
+
+    T* data() { return m_data; }
+    T const* data() const { return m_data; }
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+    T& operator[](size_type index) { return m_data[index]; }
+    T const& operator[](size_type index) const { return m_data[index]; }
+    T& at(size_type index)
+    {
+        check(index);
+        return m_data[index];
+    }
+    T const& at(size_type index) const
+    {
+        check(index);
+        return m_data[index];
+    }
+
+    void clear() { m_size = 0; }
+
+    void reserve(size_type capacity)
+    {
+        if (m_capacity < capacity) {
+            T* data = new T[capacity];
+            if (0 < m_size) {
+                std::memcpy(data, m_data, m_size * sizeof(T));
+            }
+            release();
+            m_data = data;
+            m_capacity = static_cast<std::uint32_t>(capacity);
+        }
+    }
+
+    // Values past the old size are value-initialized
+    void resize(size_type size)
+    {
+        reserve(size);
+        if (m_size < size) {
+            std::fill(m_data + m_size, m_data + size, T());
+        }
+        m_size = static_cast<std::uint32_t>(size);
+    }
+
+    void push_back(T const& value)
+    {
+        if (m_size == m_capacity) {
+            reserve(m_capacity * 2);
+        }
+        m_data[m_size++] = value;
+    }
+
+    // Replace the values with count values from values, which must not point into this list
+    void assign(T const* values, size_type count)
+    {
+        if (m_capacity < count) {
+            m_size = 0;
+            reserve(count);
+        }
+        if (0 < count) {
+            std::memcpy(m_data, values, count * sizeof(T));
+        }
+        m_size = static_cast<std::uint32_t>(count);
+    }
+
+    friend bool operator==(SmallVector const& a, SmallVector const& b)
+    {
+        return a.m_size == b.m_size && std::equal(a.begin(), a.end(), b.begin());
+    }
+    friend bool operator!=(SmallVector const& a, SmallVector const& b) { return !(a == b); }
+
+private:
+    void check(size_type index) const
+    {
+        if (m_size <= index) {
+            throw std::out_of_range("SmallVector::at");
+        }
+    }
+
+    void release()
+    {
+        if (!is_inline()) {
+            delete[] m_data;
+        }
+        m_data = m_inline;
+        m_capacity = static_cast<std::uint32_t>(N);
+    }
+
+    // Steal the heap buffer of other or copy its inline values, other is left empty. This must be inline.
+    void take(SmallVector& other)
+    {
+        if (other.is_inline()) {
+            assign(other.m_data, other.m_size);
+        }
+        else {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = other.m_inline;
+            other.m_capacity = static_cast<std::uint32_t>(N);
+        }
+        other.m_size = 0;
+    }
+
+private:
+    T* m_data;                  // m_inline or a heap buffer
+    std::uint32_t m_size;
+    std::uint32_t m_capacity;
+    T m_inline[N];
+};
+
+} // namespace cli
+
+#endif // !SMALLVECTOR_H
@@ -6,6 +6,7 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace cli
 {
@@ -22,6 +23,7 @@ using text_char = TCHAR;
 /*** Text String ***/
 using text_literal = text_char const*;
 using text = std::basic_string<text_char>;
+using text_view = std::basic_string_view<text_char>;
 
 /*** Text Regex ***/
 using tregex = std::basic_regex<text_char>;
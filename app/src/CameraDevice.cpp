@@ -14,7 +14,10 @@
 #endif
 
 #include "CameraDevice.h"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <ctime>
 #if defined(__GNUC__) && __GNUC__ < 8
 #include <experimental/filesystem>
 namespace fs = std::experimental::filesystem;
@@ -23,8 +26,12 @@ namespace fs = std::experimental::filesystem;
 namespace fs = std::filesystem;
 #endif
 #include <fstream>
+#include <iomanip>
+#include <mutex>
 #include <thread>
 #include "CrDeviceProperty.h"
+#include "JpegValidator.h"
+#include "PropertyDecoder.h"
 #include "Text.h"
 
 
@@ -80,6 +87,28 @@ using namespace std::chrono_literals;
 
 constexpr int const ImageSaveAutoStartNo = -1;
 
+// One row of the live-view latency table
+void print_histogram(char const* name, cli::LatencyHistogram const& histogram)
+{
+    cli::tout << std::left << std::setw(22) << name << std::right
+        << std::setw(9) << histogram.count()
+        << std::setw(9) << histogram.min()
+        << std::setw(9) << histogram.percentile(50.0)
+        << std::setw(9) << histogram.percentile(90.0)
+        << std::setw(9) << histogram.percentile(99.0)
+        << std::setw(9) << histogram.percentile(99.9)
+        << std::setw(9) << histogram.max()
+        << std::setw(10) << static_cast<std::uint64_t>(histogram.mean() + 0.5) << '\n';
+}
+
+// Whether the current value of record is value, compared in the width of its type
+bool holds_value(cli::PropertyRecord const& record, CrInt64u value)
+{
+    std::size_t const size = cli::PropertyRegistry::element_size(record.type);
+    CrInt64u const mask = (0 == size || 8 <= size) ? ~CrInt64u(0) : (CrInt64u(1) << (8 * size)) - 1;
+    return (record.current & mask) == (value & mask);
+}
+
 namespace cli
 {
 CameraDevice::CameraDevice(std::int32_t no, SCRSDK::ICrCameraObjectInfo const* camera_info)
@@ -90,7 +119,18 @@ CameraDevice::CameraDevice(std::int32_t no, SCRSDK::ICrCameraObjectInfo const* c
     , m_net_info()
     , m_usb_info()
     , m_prop()
+    , m_prop_changes()
+    , m_prop_refresh_codes()
+    , m_prop_registry()
+    , m_prop_history()
+    , m_prop_subscriptions(&m_prop_history)
     , m_lvEnbSet(true)
+    , m_lv_stream()
+    , m_lv_writer()
+    , m_lv_http()
+    , m_lv_shm()
+    , m_lv_overlay()
+    , m_lv_focus()
     , m_modeSDK(SCRSDK::CrSdkControlMode_Remote)
     , m_spontaneous_disconnection(false)
     , m_fingerprint("")
@@ -108,6 +148,7 @@ CameraDevice::CameraDevice(std::int32_t no, SCRSDK::ICrCameraObjectInfo const* c
         camera_info->GetPairingNecessity(),
         camera_info->GetSSHsupport()
     );
+    m_lv_stream.set_camera(m_number);
 
     m_conn_type = parse_connection_type(m_info->GetConnectionTypeName());
     switch (m_conn_type)
@@ -236,6 +277,7 @@ bool CameraDevice::connect(SCRSDK::CrSdkControlMode openMode, SCRSDK::CrReconnec
         m_userPassword.clear();
         return false;
     }
+    m_prop_subscriptions.open(m_device_handle);
     set_save_info();
     return true;
 }
@@ -245,6 +287,12 @@ bool CameraDevice::disconnect()
     // m_fingerprint.clear();  // Use as needed
     // m_userPassword.clear(); // Use as needed
     m_spontaneous_disconnection = true;
+    m_prop_subscriptions.close();
+    m_lv_focus.stop();
+    m_lv_shm.stop();
+    m_lv_http.stop();
+    m_lv_writer.stop();
+    m_lv_stream.close();
     tout << "Disconnect from camera...\n";
     auto disconnect_status = SDK::Disconnect(m_device_handle);
     if (CR_FAILED(disconnect_status)) {
@@ -257,6 +305,15 @@ bool CameraDevice::disconnect()
 bool CameraDevice::release()
 {
     tout << "Release camera...\n";
+    m_prop_subscriptions.close();
+    m_lv_focus.stop();
+    m_lv_shm.stop();
+    m_lv_http.stop();
+    m_lv_writer.stop();
+    m_lv_stream.close();
+    if (0 < m_lv_stream.fetch_latency().count()) {
+        get_live_view_latency();
+    }
     auto finalize_status = SDK::ReleaseDevice(m_device_handle);
     m_device_handle = 0; // clear
     if (CR_FAILED(finalize_status)) {
@@ -273,7 +330,7 @@ CrInt32u CameraDevice::get_sshsupport()
 
 SCRSDK::CrSdkControlMode CameraDevice::get_sdkmode() 
 {
-    load_properties();
+    refresh_properties();
     if (SDK::CrSdkControlMode_ContentsTransfer == m_modeSDK) {
         tout << TEXT("Contents Transfer Mode\n");
     }
@@ -311,13 +368,13 @@ void CameraDevice::s1_shooting() const
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_S1);
     prop.SetCurrentValue(SDK::CrLockIndicator::CrLockIndicator_Locked);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 
     // Wait, then send shutter up
     std::this_thread::sleep_for(1s);
     tout << "Shutter Half Press up\n";
     prop.SetCurrentValue(SDK::CrLockIndicator::CrLockIndicator_Unlocked);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::af_shutter() const
@@ -336,7 +393,7 @@ void CameraDevice::af_shutter() const
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_S1);
     prop.SetCurrentValue(SDK::CrLockIndicator::CrLockIndicator_Locked);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 
     // Wait, then send shutter down
     std::this_thread::sleep_for(500ms);
@@ -352,12 +409,12 @@ void CameraDevice::af_shutter() const
     std::this_thread::sleep_for(1s);
     tout << "Shutter Half Press up\n";
     prop.SetCurrentValue(SDK::CrLockIndicator::CrLockIndicator_Unlocked);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::continuous_shooting()
 {
-    load_properties();
+    refresh_properties();
     tout << "Capture image...\n";
     tout << "Continuous Shooting\n";
     if (1 == m_prop.position_key_setting.writable) {
@@ -366,12 +423,12 @@ void CameraDevice::continuous_shooting()
         priority.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings);
         priority.SetCurrentValue(SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote);
         priority.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
-        auto err_priority = SDK::SetDeviceProperty(m_device_handle, &priority);
+        auto err_priority = set_property(priority);
         if (CR_FAILED(err_priority)) {
             tout << "Priority Key setting FAILED\n";
             return;
         }
-        std::this_thread::sleep_for(500ms);
+        await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings, SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote, 500ms);
         get_position_key_setting();
     }
 
@@ -379,10 +436,10 @@ void CameraDevice::continuous_shooting()
     SDK::CrDeviceProperty mode;
     auto& values = m_prop.still_capture_mode.possible;
     mode.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_DriveMode);
-    if (find(values.begin(), values.end(), SDK::CrDriveMode::CrDrive_Continuous_Hi) != values.end()) {
+    if (std::find(values.begin(), values.end(), SDK::CrDriveMode::CrDrive_Continuous_Hi) != values.end()) {
         mode.SetCurrentValue(SDK::CrDriveMode::CrDrive_Continuous_Hi);
     }
-    else if (find(values.begin(), values.end(), SDK::CrDriveMode::CrDrive_Continuous) != values.end()) {
+    else if (std::find(values.begin(), values.end(), SDK::CrDriveMode::CrDrive_Continuous) != values.end()) {
         mode.SetCurrentValue(SDK::CrDriveMode::CrDrive_Continuous);
     }
     else if (1 == m_prop.still_capture_mode.writable) {
@@ -394,14 +451,13 @@ void CameraDevice::continuous_shooting()
         return;
     }
     mode.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
-    auto err_still_capture_mode = SDK::SetDeviceProperty(m_device_handle, &mode);
+    auto err_still_capture_mode = set_property(mode);
     if (CR_FAILED(err_still_capture_mode)) {
         tout << "Still Capture Mode setting FAILED\n";
         return;
     }
 
-    // get_still_capture_mode();
-    std::this_thread::sleep_for(1s);
+    await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_DriveMode, mode.GetCurrentValue(), 1s);
     get_still_capture_mode();
 
 	if ((m_prop.still_capture_mode.current == SDK::CrDriveMode::CrDrive_Continuous_Hi)||
@@ -422,50 +478,50 @@ void CameraDevice::continuous_shooting()
 
 void CameraDevice::get_aperture()
 {
-    load_properties();
+    refresh_properties();
     tout << format_f_number(m_prop.f_number.current) << '\n';
 }
 
 void CameraDevice::get_iso()
 {
-    load_properties();
+    refresh_properties();
 
     tout << "ISO: " << format_iso_sensitivity(m_prop.iso_sensitivity.current) << '\n';
 }
 
 void CameraDevice::get_shutter_speed()
 {
-    load_properties();
+    refresh_properties();
     tout << "Shutter Speed: " << format_shutter_speed(m_prop.shutter_speed.current) << '\n';
 }
 
 void CameraDevice::get_position_key_setting()
 {
-    load_properties();
+    refresh_properties();
     tout << "Position Key Setting: " << format_position_key_setting(m_prop.position_key_setting.current) << '\n';
 }
 
 void CameraDevice::get_exposure_program_mode()
 {
-    load_properties();
+    refresh_properties();
     tout << "Exposure Program Mode: " << format_exposure_program_mode(m_prop.exposure_program_mode.current) << '\n';
 }
 
 void CameraDevice::get_still_capture_mode()
 {
-    load_properties();
+    refresh_properties();
     tout << "Still Capture Mode: " << format_still_capture_mode(m_prop.still_capture_mode.current) << '\n';
 }
 
 void CameraDevice::get_focus_mode()
 {
-    load_properties();
+    refresh_properties();
     tout << "Focus Mode: " << format_focus_mode(m_prop.focus_mode.current) << '\n';
 }
 
 void CameraDevice::get_focus_area()
 {
-    load_properties();
+    refresh_properties();
     tout << "Focus Area: " << format_focus_area(m_prop.focus_area.current) << '\n';
 }
 
@@ -482,109 +538,848 @@ void CameraDevice::get_live_view()
     }
     SDK::ReleaseLiveViewProperties(m_device_handle, property);
 
-    SDK::CrImageInfo inf;
-    err = SDK::GetLiveViewImageInfo(m_device_handle, &inf);
-    if (CR_FAILED(err)) {
-        tout << "GetLiveView FAILED\n";
+    if (!m_lv_stream.is_open()) {
+        err = m_lv_stream.open(m_device_handle);
+        if (CR_FAILED(err)) {
+            tout << "GetLiveView FAILED\n";
+            return;
+        }
+    }
+
+    LiveViewFrame* frame = nullptr;
+    if (m_lv_stream.is_running()) {
+        // The fetch thread owns the SDK poll, take the next frame it publishes
+        auto ring = m_lv_stream.subscribe(1);
+        frame = ring->pop_wait(1000ms);
+        m_lv_stream.unsubscribe(ring);
+        err = frame ? SDK::CrError_None : SDK::CrWarning_Frame_NotUpdated;
+    }
+    else {
+        err = m_lv_stream.fetch(frame);
+    }
+    if (CR_FAILED(err))
+    {
+        // FAILED
+        if (err == SDK::CrWarning_Frame_NotUpdated) {
+            tout << "Warning. GetLiveView Frame NotUpdate\n";
+        }
+        else if (err == SDK::CrError_Memory_Insufficient) {
+            tout << "Warning. GetLiveView Memory insufficient\n";
+        }
         return;
     }
 
-    CrInt32u bufSize = inf.GetBufferSize();
-    if (bufSize < 1)
+    // Display
+    // etc.
+#if defined(__APPLE__)
+    char path[MAC_MAX_PATH]; /*MAX_PATH*/
+    memset(path, 0, sizeof(path));
+    if(NULL == getcwd(path, sizeof(path) - 1)){
+        // FAILED
+        m_lv_stream.release(frame);
+        tout << "Folder path is too long.\n";
+        return;
+    }
+    char filename[] ="/LiveView000000.JPG";
+    if(strlen(path) + strlen(filename) > MAC_MAX_PATH){
+        // FAILED
+        m_lv_stream.release(frame);
+        tout << "Failed to create save path.\n";
+        return;
+    }
+    strncat(path, filename, strlen(filename));
+#else
+    auto path = fs::current_path();
+    path.append(TEXT("LiveView000000.JPG"));
+#endif
+    tout << path << '\n';
+
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    if (!file.bad())
     {
-        tout << "GetLiveView FAILED \n";
+        file.write((char const*)frame->data, frame->size);
+        file.close();
     }
-    else
+    tout << "GetLiveView SUCCESS\n";
+    m_lv_stream.release(frame); // Back to the pool
+}
+
+void CameraDevice::start_live_view_stream()
+{
+    if (m_lv_stream.is_running()) {
+        tout << "Live View Stream is already running.\n";
+        return;
+    }
+    if (!m_lv_stream.is_open()) {
+        auto err = m_lv_stream.open(m_device_handle);
+        if (CR_FAILED(err)) {
+            tout << "Live View Stream FAILED\n";
+            return;
+        }
+    }
+    if (m_lv_stream.start()) {
+        tout << "Live View Stream started.\n";
+    }
+    else {
+        tout << "Live View Stream FAILED\n";
+    }
+}
+
+void CameraDevice::stop_live_view_stream()
+{
+    if (!m_lv_stream.is_running()) {
+        tout << "Live View Stream is not running.\n";
+        return;
+    }
+    m_lv_stream.stop();
+    tout << "Live View Stream stopped.\n";
+}
+
+bool CameraDevice::join_live_view_multiplexer(LiveViewMultiplexer& mux, int cpu)
+{
+    if (!m_connected.load()) {
+        return false;
+    }
+    if (!m_lv_stream.is_open()) {
+        auto err = m_lv_stream.open(m_device_handle);
+        if (CR_FAILED(err)) {
+            return false;
+        }
+    }
+    m_lv_stream.set_cpu(cpu);
+    mux.add(m_number, m_lv_stream);
+    return m_lv_stream.is_running() || m_lv_stream.start();
+}
+
+void CameraDevice::leave_live_view_multiplexer(LiveViewMultiplexer& mux)
+{
+    mux.remove(m_number);
+    m_lv_stream.set_cpu(-1);
+}
+
+void CameraDevice::start_live_view_recording()
+{
+    if (m_lv_writer.is_running()) {
+        tout << "Live View Recording is already running.\n";
+        return;
+    }
+
+    LiveViewWriterConfig config;
+    text input;
+    tout << "Choose a recording mode:\n";
+    tout << "[1] Numbered JPEG files\n";
+    tout << "[2] Append to a single file\n";
+    tout << "[3] Indexed capture container\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    if (input == TEXT("2")) {
+        config.mode = LiveViewWriteMode::AppendFile;
+    }
+    else if (input == TEXT("3")) {
+        config.mode = LiveViewWriteMode::Container;
+    }
+    else if (input != TEXT("1")) {
+        tout << "Input cancelled.\n";
+        return;
+    }
+
+    auto default_path = fs::current_path();
+    switch (config.mode) {
+    case LiveViewWriteMode::AppendFile:
+        default_path.append(TEXT("LiveView.mjpg"));
+        break;
+    case LiveViewWriteMode::Container:
+        default_path.append(TEXT("LiveView.lvc"));
+        break;
+    default:
+        default_path.append(TEXT("LiveView"));
+        break;
+    }
+    tout << "Enter the " << (LiveViewWriteMode::NumberedFiles == config.mode ? "folder" : "file")
+        << " path (empty for " << default_path << "):\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    config.path = input.empty() ? default_path.string<text_char>() : input;
+
+    tout << "Choose a sync policy:\n";
+    tout << "[0] None\n";
+    tout << "[1] Every batch\n";
+    tout << "[2] Every second\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    if (input == TEXT("1")) {
+        config.sync = LiveViewSyncPolicy::EveryBatch;
+    }
+    else if (input == TEXT("2")) {
+        config.sync = LiveViewSyncPolicy::Interval;
+    }
+
+    if (!m_lv_stream.is_running()) {
+        start_live_view_stream();
+        if (!m_lv_stream.is_running()) {
+            return;
+        }
+    }
+    if (m_lv_writer.start(m_lv_stream, config)) {
+        tout << "Live View Recording started.\n";
+    }
+    else {
+        tout << "Live View Recording FAILED\n";
+    }
+}
+
+void CameraDevice::stop_live_view_recording()
+{
+    if (!m_lv_writer.is_running()) {
+        if (m_lv_writer.failed()) {
+            tout << "Live View Recording stopped after a write error. " << m_lv_writer.frames_written() << " frames written.\n";
+        }
+        else {
+            tout << "Live View Recording is not running.\n";
+        }
+        return;
+    }
+    m_lv_writer.stop();
+    tout << "Live View Recording stopped. " << m_lv_writer.frames_written() << " frames written.\n";
+}
+
+void CameraDevice::seek_live_view_capture()
+{
+    text input;
+    tout << "Enter the capture file path:\n";
+    tout << "input> ";
+    std::getline(tin, input);
+
+    LiveViewContainerReader reader;
+    if (!reader.open(input)) {
+        tout << "Failed to open the capture file.\n";
+        return;
+    }
+    if (0 == reader.size()) {
+        tout << "The capture file has no frames.\n";
+        return;
+    }
+
+    auto const first = reader.record(0);
+    auto const last = reader.record(reader.size() - 1);
+    tout << "Frames: " << reader.size() << (reader.indexed() ? "" : " (index rebuilt)")
+        << ", Duration: " << std::chrono::duration_cast<std::chrono::milliseconds>(last.host_time).count() << " ms\n";
+    tout << "Time code: " << std::hex << std::setfill(TEXT('0')) << std::setw(8) << first.time_code
+        << " - " << std::setw(8) << last.time_code << std::dec << std::setfill(TEXT(' ')) << '\n';
+
+    tout << "Seek by:\n";
+    tout << "[1] Elapsed milliseconds\n";
+    tout << "[2] Time code (hex)\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    bool by_time_code = (input == TEXT("2"));
+    if (!by_time_code && input != TEXT("1")) {
+        tout << "Input cancelled.\n";
+        return;
+    }
+
+    tout << "input> ";
+    std::getline(tin, input);
+    text_stringstream ss(input);
+    std::size_t index = reader.size();
+    if (by_time_code) {
+        CrInt32u time_code = 0;
+        ss >> std::hex >> time_code;
+        index = reader.seek_time_code(time_code);
+    }
+    else {
+        std::int64_t ms = 0;
+        ss >> ms;
+        index = reader.seek_host_time(std::chrono::milliseconds(ms));
+    }
+    if (reader.size() <= index) {
+        tout << "No frame at or after the requested time.\n";
+        return;
+    }
+
+    auto const record = reader.record(index);
+    auto path = fs::current_path();
+    path.append(TEXT("LiveViewSeek.JPG"));
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    if (!file.bad())
     {
-        auto* image_data = new SDK::CrImageDataBlock();
-        if (!image_data)
-        {
-            tout << "GetLiveView FAILED (new CrImageDataBlock class)\n";
+        file.write((char const*)record.data, record.size);
+        file.close();
+    }
+    tout << "Frame " << index << " (No. " << record.frame_no << ", "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(record.host_time).count() << " ms) written to " << path << '\n';
+}
+
+void CameraDevice::start_live_view_server()
+{
+    if (m_lv_http.is_running()) {
+        tout << "Live View Server is already running on port " << m_lv_http.port() << ".\n";
+        return;
+    }
+
+    // One port per connected camera
+    auto port = static_cast<std::uint16_t>(LiveViewHttpServer::DefaultPort + m_number - 1);
+    text input;
+    tout << "Enter the port number (empty for " << port << "):\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    if (!input.empty()) {
+        text_stringstream ss(input);
+        int value = 0;
+        ss >> value;
+        if (value <= 0 || 0xFFFF < value) {
+            tout << "Input cancelled.\n";
             return;
         }
-        CrInt8u* image_buff = new CrInt8u[bufSize];
-        if (!image_buff)
-        {
-            delete image_data;
-            tout << "GetLiveView FAILED (new Image buffer)\n";
+        port = static_cast<std::uint16_t>(value);
+    }
+
+    if (!m_lv_stream.is_running()) {
+        start_live_view_stream();
+        if (!m_lv_stream.is_running()) {
             return;
         }
-        image_data->SetSize(bufSize);
-        image_data->SetData(image_buff);
+    }
+    if (m_lv_http.start(m_lv_stream, port)) {
+        tout << "Live View Server started: http://127.0.0.1:" << port << "/\n";
+    }
+    else {
+        tout << "Live View Server FAILED\n";
+    }
+}
 
-        err = SDK::GetLiveViewImage(m_device_handle, image_data);
-        if (CR_FAILED(err))
-        {
-            // FAILED
-            if (err == SDK::CrWarning_Frame_NotUpdated) {
-                tout << "Warning. GetLiveView Frame NotUpdate\n";
+void CameraDevice::stop_live_view_server()
+{
+    if (!m_lv_http.is_running()) {
+        tout << "Live View Server is not running.\n";
+        return;
+    }
+    m_lv_http.stop();
+    tout << "Live View Server stopped.\n";
+}
+
+void CameraDevice::start_live_view_shm()
+{
+    if (m_lv_shm.is_running()) {
+        tout << "Live View Shared Memory is already published as " << m_lv_shm.name().c_str() << ".\n";
+        return;
+    }
+
+    std::string name = "/crsdk_lv" + std::to_string(m_number);
+    text input;
+    tout << "Enter the shared memory name (empty for " << name.c_str() << "):\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    if (!input.empty()) {
+        name = fs::path(input).string();
+        if ('/' != name[0]) {
+            name.insert(0, 1, '/');
+        }
+    }
+
+    if (!m_lv_stream.is_running()) {
+        start_live_view_stream();
+        if (!m_lv_stream.is_running()) {
+            return;
+        }
+    }
+    if (m_lv_shm.start(m_lv_stream, name)) {
+        tout << "Live View Shared Memory published as " << name.c_str() << ".\n";
+    }
+    else {
+        tout << "Live View Shared Memory FAILED\n";
+    }
+}
+
+void CameraDevice::stop_live_view_shm()
+{
+    if (!m_lv_shm.is_running()) {
+        tout << "Live View Shared Memory is not published.\n";
+        return;
+    }
+    m_lv_shm.stop();
+    tout << "Live View Shared Memory stopped.\n";
+}
+
+void CameraDevice::get_live_view_latency()
+{
+    tout << "Live View Latency (us)\n";
+    tout << std::left << std::setw(22) << "" << std::right
+        << std::setw(9) << "count" << std::setw(9) << "min" << std::setw(9) << "p50" << std::setw(9) << "p90"
+        << std::setw(9) << "p99" << std::setw(9) << "p99.9" << std::setw(9) << "max" << std::setw(10) << "mean" << '\n';
+    print_histogram("GetLiveViewImage", m_lv_stream.fetch_latency());
+    print_histogram("Frame interval", m_lv_stream.frame_interval());
+    print_histogram("Write age", m_lv_writer.write_age());
+    tout << "Polls per new frame (count)\n";
+    print_histogram("Retries", m_lv_stream.retries_per_frame());
+    tout << "Frame NotUpdated: " << m_lv_stream.not_updated()
+        << ", Duplicated: " << m_lv_stream.poller().duplicated()
+        << ", Memory insufficient: " << m_lv_stream.memory_insufficient()
+        << ", Skipped frame numbers: " << m_lv_stream.poller().skipped() << '\n';
+}
+
+void CameraDevice::get_live_view_overlay()
+{
+    LiveViewOverlay overlay;
+    m_lv_overlay.read(overlay);
+    if (0 == overlay.version) {
+        tout << "No Live View overlay received.\n";
+        return;
+    }
+
+    auto print_rect = [](char const* name, std::size_t no, LiveViewOverlayRect const& rect) {
+        char buff[160];
+        snprintf(buff, sizeof(buff), "  %s no[%d] type[%d] state[%d] priority[%d] center[%.4f, %.4f] size[%.4f x %.4f]",
+            name, static_cast<int>(no + 1), rect.type, rect.state, rect.priority, rect.x, rect.y, rect.width, rect.height);
+        tout << buff << '\n';
+    };
+
+    tout << "Live View Overlay: update " << overlay.version
+        << ", TimeCode " << std::hex << std::setfill(TEXT('0')) << std::setw(8) << overlay.time_code << std::dec << std::setfill(TEXT(' '))
+        << (overlay.truncated ? " (truncated)" : "") << '\n';
+    for (std::size_t i = 0; i < overlay.focus_count; ++i) print_rect("FocusFrameInfo", i, overlay.focus[i]);
+    for (std::size_t i = 0; i < overlay.face_count; ++i) print_rect("FaceFrameInfo", i, overlay.face[i]);
+    for (std::size_t i = 0; i < overlay.tracking_count; ++i) print_rect("TrackingFrameInfo", i, overlay.tracking[i]);
+    if (overlay.has_magnifier) print_rect("MagPosInfo", 0, overlay.magnifier);
+}
+
+void CameraDevice::get_all_properties()
+{
+    refresh_properties();
+    text input;
+    tout << "Enter a property code in hex (empty for all " << m_prop_registry.size() << " properties):\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    CrInt32u code = 0;
+    if (!input.empty()) {
+        text_stringstream ss(input);
+        ss >> std::hex >> code;
+        if (!m_prop_registry.find(code)) {
+            tout << "Property 0x" << std::hex << code << std::dec << " is not reported by the camera.\n";
+            return;
+        }
+    }
+
+    // All possible values for one property, the first few otherwise
+    std::size_t const max_values = input.empty() ? 8 : static_cast<std::size_t>(-1);
+    tout << "code   - type   - enable - variable - read - write - current - possible\n";
+    for (auto const& record : m_prop_registry) {
+        if (!input.empty() && record.code != code) {
+            continue;
+        }
+        tout << std::hex << std::setfill(TEXT('0'))
+            << std::setw(4) << record.code << " - " << std::setw(4) << record.type << std::dec << std::setfill(TEXT(' '))
+            << " - " << std::setw(6) << record.enable_flag
+            << " - " << std::setw(8) << record.variable_flag
+            << " - " << std::setw(4) << (record.readable ? "yes" : "no")
+            << " - " << std::setw(5) << (record.writable ? "yes" : "no") << " - ";
+        if (SDK::CrDataType_STR == record.type) {
+            tout << '"' << m_prop_registry.current_text(record) << "\"\n";
+            continue;
+        }
+        tout << "0x" << std::hex << record.current << std::dec;
+        std::size_t const count = m_prop_registry.value_count(record);
+        tout << " - " << count << ((record.type & SDK::CrDataType_RangeBit) ? " (range)" : "");
+        for (std::size_t i = 0; i < count && i < max_values; ++i) {
+            tout << (0 == i ? ": " : ", ") << m_prop_registry.value_at(record, i);
+        }
+        tout << ((max_values < count) ? ", ...\n" : "\n");
+    }
+}
+
+bool CameraDevice::apply_properties(std::vector<PropertyAssignment>& batch, std::chrono::milliseconds timeout)
+{
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    order_assignments(batch);
+    refresh_properties();
+
+    bool confirmed = true;
+    std::size_t begin = 0;
+    while (begin < batch.size()) {
+        int const stage = property_stage(batch[begin].code);
+        std::size_t end = begin;
+        for (; end < batch.size() && stage == property_stage(batch[end].code); ++end) {
+            auto& assignment = batch[end];
+            auto const record = m_prop_registry.find(assignment.code);
+            if (!record || SDK::CrDataType_STR == record->type) {
+                assignment.result = PropertyAssignmentResult::Unsupported;
+                continue;
+            }
+            if (!record->writable) {
+                assignment.result = PropertyAssignmentResult::NotWritable;
+                continue;
             }
-            else if (err == SDK::CrError_Memory_Insufficient) {
-                tout << "Warning. GetLiveView Memory insufficient\n";
+            if (holds_value(*record, assignment.value)) {
+                assignment.result = PropertyAssignmentResult::Confirmed;
+                continue;
             }
-            delete[] image_buff; // Release
-            delete image_data; // Release
+            SDK::CrDeviceProperty prop;
+            prop.SetCode(assignment.code);
+            prop.SetCurrentValue(assignment.value);
+            prop.SetValueType(static_cast<SDK::CrDataType>(record->type));
+            assignment.result = CR_FAILED(set_property(prop))
+                ? PropertyAssignmentResult::Rejected : PropertyAssignmentResult::Pending;
         }
-        else
-        {
-            if (0 < image_data->GetSize())
-            {
-                // Display
-                // etc.
-#if defined(__APPLE__)
-                char path[MAC_MAX_PATH]; /*MAX_PATH*/
-                memset(path, 0, sizeof(path));
-                if(NULL == getcwd(path, sizeof(path) - 1)){
-                    // FAILED
-                    delete[] image_buff; // Release
-                    delete image_data; // Release
-                    tout << "Folder path is too long.\n";
-                    return;
-                }
-                char filename[] ="/LiveView000000.JPG";
-                if(strlen(path) + strlen(filename) > MAC_MAX_PATH){
-                    // FAILED
-                    delete[] image_buff; // Release
-                    delete image_data; // Release
-                    tout << "Failed to create save path.\n";
-                    return;
-                }
-                strncat(path, filename, strlen(filename));
-#else
-                auto path = fs::current_path();
-                path.append(TEXT("LiveView000000.JPG"));
-#endif
-                tout << path << '\n';
+        // The next stage may depend on this one, so wait for it before going on
+        confirmed = await_assignments(batch.data() + begin, batch.data() + end, deadline) && confirmed;
+        for (std::size_t i = begin; i < end; ++i) {
+            confirmed = confirmed && PropertyAssignmentResult::Confirmed == batch[i].result;
+        }
+        begin = end;
+    }
+    return confirmed;
+}
 
-                std::ofstream file(path, std::ios::out | std::ios::binary);
-                if (!file.bad())
-                {
-                    file.write((char*)image_data->GetImageData(), image_data->GetImageSize());
-                    file.close();
-                }
-                tout << "GetLiveView SUCCESS\n";
-                delete[] image_buff; // Release
-                delete image_data; // Release
-            }
-            else
-            {
-                // FAILED
-                delete[] image_buff; // Release
-                delete image_data; // Release
+void CameraDevice::apply_property_batch()
+{
+    tout << "Enter one property per line as <code in hex> <value>, the value in decimal or with a 0x prefix.\n";
+    tout << "An empty line applies the batch.\n";
+    std::vector<PropertyAssignment> batch;
+    for (;;) {
+        text input;
+        tout << "input> ";
+        std::getline(tin, input);
+        if (input.empty()) {
+            break;
+        }
+        text_stringstream ss(input);
+        CrInt32u code = 0;
+        text value_text;
+        ss >> std::hex >> code >> value_text;
+        // Decimal, hex only with a 0x prefix: a leading zero does not make it octal
+        bool const is_hex = 2 < value_text.size() && TEXT('0') == value_text[0]
+            && (TEXT('x') == value_text[1] || TEXT('X') == value_text[1]);
+        text_stringstream vs(is_hex ? value_text.substr(2) : value_text);
+        CrInt64 value = 0;
+        vs >> (is_hex ? std::hex : std::dec) >> value;
+        if (ss.fail() || vs.fail() || !vs.eof()) {
+            tout << "Input cancelled.\n";
+            return;
+        }
+        batch.emplace_back(code, static_cast<CrInt64u>(value));
+    }
+    if (batch.empty()) {
+        return;
+    }
+
+    auto const started = std::chrono::steady_clock::now();
+    bool const confirmed = apply_properties(batch, 3s);
+    auto const elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+
+    tout << "code   - stage - value              - result\n";
+    for (auto const& assignment : batch) {
+        tout << std::hex << std::setfill(TEXT('0')) << std::setw(4) << assignment.code << std::setfill(TEXT(' '))
+            << " - " << std::dec << std::setw(5) << property_stage(assignment.code)
+            << " - 0x" << std::hex << std::left << std::setw(16) << assignment.value << std::right << std::dec
+            << " - " << format_assignment_result(assignment.result) << '\n';
+    }
+    tout << (confirmed ? "All confirmed" : "Not all confirmed") << " in " << elapsed.count() << " ms\n";
+}
+
+void CameraDevice::get_property_history()
+{
+    // Recorded by the property worker, nothing to refresh here
+    text input;
+    tout << "Enter a property code in hex (empty for all properties):\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    CrInt32u code = PropertyHistory::AnyCode;
+    if (!input.empty()) {
+        text_stringstream ss(input);
+        ss >> std::hex >> code;
+    }
+
+    std::vector<PropertyChange> changes(PropertyHistory::Capacity);
+    changes.resize(property_history(changes.data(), changes.size(), code));
+    if (changes.empty()) {
+        tout << "No property change recorded.\n";
+        return;
+    }
+
+    // Steady-clock times shown as local time
+    auto const steady_now = std::chrono::steady_clock::now();
+    auto const system_now = std::chrono::system_clock::now();
+    tout << "time         - code - old                - new                - origin\n";
+    for (auto const& change : changes) {
+        auto const when = system_now - std::chrono::duration_cast<std::chrono::system_clock::duration>(steady_now - change.time);
+        std::time_t const seconds = std::chrono::system_clock::to_time_t(when);
+        auto const ms = std::chrono::duration_cast<std::chrono::milliseconds>(when.time_since_epoch()).count() % 1000;
+        char clock[16] = "--:--:--";
+        if (std::tm const* local = std::localtime(&seconds)) {
+            std::strftime(clock, sizeof(clock), "%H:%M:%S", local);
+        }
+        char buff[160];
+        snprintf(buff, sizeof(buff), "%s.%03d - %04x - 0x%-16llx - 0x%-16llx - ", clock, static_cast<int>(ms), change.code,
+            static_cast<unsigned long long>(change.old_value), static_cast<unsigned long long>(change.new_value));
+        tout << buff;
+        if (change.own) {
+            tout << "own, reported " << change.apply_us / 1000 << " ms after set_property()\n";
+        }
+        else {
+            tout << "camera\n";
+        }
+    }
+    tout << changes.size() << " of " << m_prop_history.recorded() << " recorded changes\n";
+}
+
+void CameraDevice::watch_properties()
+{
+    struct Watched
+    {
+        CrInt32u code;
+        char const* name;
+    };
+    static Watched const watched[] = {
+        { SDK::CrDevicePropertyCode::CrDeviceProperty_RecordingState, "RecordingState" },
+        { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_Status, "MediaSLOT1_Status" },
+        { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_Status, "MediaSLOT2_Status" },
+        { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusDrivingStatus, "FocusDrivingStatus" },
+    };
+
+    text input;
+    tout << "Watch for how many seconds?\n";
+    tout << "input> ";
+    std::getline(tin, input);
+    text_stringstream ss(input);
+    int seconds = 0;
+    ss >> seconds;
+    if (ss.fail() || seconds <= 0) {
+        tout << "Input cancelled.\n";
+        return;
+    }
+
+    // The worker only queues the events, they are printed here on the menu thread
+    std::mutex events_mtx;
+    std::condition_variable events_cv;
+    std::vector<PropertyEvent> events;
+    std::vector<PropertySubscriptions::Id> ids;
+    for (auto const& property : watched) {
+        ids.push_back(m_prop_subscriptions.subscribe(property.code, [&](PropertyEvent const& event) {
+            std::lock_guard<std::mutex> lock(events_mtx);
+            events.push_back(event);
+            events_cv.notify_one();
+        }));
+    }
+
+    tout << "Watching property changes for " << seconds << " s.\n";
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+    std::vector<PropertyEvent> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(events_mtx);
+            events_cv.wait_until(lock, deadline, [&] { return !events.empty(); });
+            batch.swap(events);
+        }
+        for (auto const& event : batch) {
+            auto const property = std::find_if(std::begin(watched), std::end(watched),
+                [&](Watched const& w) { return w.code == event.code; });
+            tout << property->name << ": ";
+            if (!event.initial) {
+                tout << "0x" << std::hex << event.old_value << " -> ";
             }
+            tout << "0x" << std::hex << event.new_value << std::dec << '\n';
+        }
+        batch.clear();
+        if (deadline <= std::chrono::steady_clock::now()) {
+            break;
+        }
+    }
+    // Waits for a running subscriber, nothing touches the locals afterwards
+    for (auto id : ids) {
+        m_prop_subscriptions.unsubscribe(id);
+    }
+    tout << m_prop_subscriptions.delivered() << " events delivered from " << m_prop_subscriptions.fetches() << " fetches\n";
+}
+
+void CameraDevice::get_property_decode_benchmark()
+{
+    std::int32_t nprop = 0;
+    SDK::CrDeviceProperty* prop_list = nullptr;
+    auto const requested = std::chrono::steady_clock::now();
+    auto status = SDK::GetDeviceProperties(m_device_handle, &prop_list, &nprop);
+    auto const fetched = std::chrono::steady_clock::now();
+    if (CR_FAILED(status) || !prop_list || nprop < 1) {
+        tout << "Failed to get device properties.\n";
+        return;
+    }
+
+    // Decode into a scratch table so m_prop keeps tracking the camera
+    PropertyValueTable table;
+    int decoded = 0;
+    for (std::int32_t i = 0; i < nprop; ++i) {
+        decoded += decode_property(table, prop_list[i]) ? 1 : 0;
+    }
+    constexpr int const Passes = 1000;
+    auto const started = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < Passes; ++pass) {
+        for (std::int32_t i = 0; i < nprop; ++i) {
+            decode_property(table, prop_list[i]);
+        }
+    }
+    auto const finished = std::chrono::steady_clock::now();
+    SDK::ReleaseDeviceProperties(m_device_handle, prop_list);
+
+    double const list_us = std::chrono::duration<double, std::micro>(finished - started).count() / Passes;
+    tout << "Properties: " << nprop << ", decoded: " << decoded << " (" << decoded_property_count() << " codes known)\n";
+    tout << "GetDeviceProperties: " << std::chrono::duration_cast<std::chrono::microseconds>(fetched - requested).count() << " us\n";
+    tout << "Decode: " << list_us << " us per list, " << list_us * 1000.0 / nprop << " ns per property (" << Passes << " passes)\n";
+}
+
+void CameraDevice::get_live_view_focus()
+{
+    if (!m_lv_stream.is_running()) {
+        start_live_view_stream();
+        if (!m_lv_stream.is_running()) {
+            return;
+        }
+    }
+    if (!m_lv_focus.is_running()) {
+        m_lv_focus.start(m_lv_stream, m_lv_overlay);
+    }
+
+    // A few consecutive scores, so the trend is visible while focusing
+    LiveViewFocusResult result = m_lv_focus.latest();
+    for (int i = 0; i < 5; ++i) {
+        if (!m_lv_focus.wait_newer(result.sequence, std::chrono::seconds(1), result)) {
+            tout << "No Live View frame scored.\n";
+            break;
         }
+        char buff[192];
+        snprintf(buff, sizeof(buff), "Focus score %10.2f  No. %u  ROI[%d, %d %dx%d]%s  decode %lld us, kernel %lld us",
+            result.score, result.frame_no, result.roi.x, result.roi.y, result.roi.width, result.roi.height,
+            result.focus_frames ? " (focus frame)" : " (full frame)",
+            static_cast<long long>(result.decode_us), static_cast<long long>(result.kernel_us));
+        tout << buff << '\n';
     }
+    tout << "Scored: " << m_lv_focus.scored()
+        << ", Decode failed: " << m_lv_focus.decode_failed()
+        << ", Dropped: " << m_lv_focus.dropped()
+        << ", Score age p50/p99: " << m_lv_focus.score_age().percentile(50.0) << "/" << m_lv_focus.score_age().percentile(99.0) << " us\n";
+}
+
+void CameraDevice::check_live_view_stall()
+{
+    if (!m_lv_stream.is_running()) {
+        start_live_view_stream();
+        if (!m_lv_stream.is_running()) {
+            return;
+        }
+    }
+
+    // A subscriber which never pops, on top of whatever else is subscribed
+    auto stalled = m_lv_stream.subscribe();
+    auto const fetched = m_lv_stream.fetched();
+    auto const exhausted = m_lv_stream.pool_exhausted();
+    std::this_thread::sleep_for(std::chrono::seconds(3));
+    auto const fetched_during = m_lv_stream.fetched() - fetched;
+    auto const exhausted_during = m_lv_stream.pool_exhausted() - exhausted;
+    auto const dropped = stalled->dropped();
+    m_lv_stream.unsubscribe(stalled);
+
+    tout << "Frames fetched: " << fetched_during
+        << ", Frame pool exhausted: " << exhausted_during
+        << ", Dropped by the stalled subscriber: " << dropped << '\n';
+    if (0 == fetched_during) {
+        tout << "Live View Stall Check FAILED: no frame fetched\n";
+    }
+    else if (0 != exhausted_during) {
+        tout << "Live View Stall Check FAILED: the stalled subscriber starved the frame pool\n";
+    }
+    else {
+        tout << "Live View Stall Check passed\n";
+    }
+}
+
+void CameraDevice::set_live_view_target_fps()
+{
+    tout << "Live View target frame rate: ";
+    if (0.0 < m_lv_stream.target_fps()) {
+        tout << m_lv_stream.target_fps() << " fps\n";
+    }
+    else {
+        tout << "camera rate\n";
+    }
+    tout << "Enter the target frame rate (0 for the camera rate):\n";
+    tout << "input> ";
+    text input;
+    std::getline(tin, input);
+    text_stringstream ss(input);
+    double fps = -1.0;
+    ss >> fps;
+    if (fps < 0.0) {
+        tout << "Input cancelled.\n";
+        return;
+    }
+    m_lv_stream.set_target_fps(fps);
+    tout << "Live View target frame rate set.\n";
+}
+
+void CameraDevice::get_live_view_stream_status()
+{
+    auto const& pool = m_lv_stream.pool();
+    tout << "Live View Stream: " << (m_lv_stream.is_running() ? "running" : "stopped") << '\n';
+    tout << "Frames fetched: " << m_lv_stream.fetched() << '\n';
+    tout << "Frame NotUpdated: " << m_lv_stream.not_updated()
+        << ", Memory insufficient: " << m_lv_stream.memory_insufficient()
+        << ", Frame pool exhausted: " << m_lv_stream.pool_exhausted()
+        << ", Fetch failed: " << m_lv_stream.fetch_failed()
+        << ", Invalid JPEG: " << m_lv_stream.invalid_frames() << '\n';
+    tout << "Frame pool: " << pool.in_use() << "/" << pool.size() << " in use, "
+        << pool.buffer_size() << " bytes, grown " << pool.grow_count() << " times\n";
+
+    auto const& poller = m_lv_stream.poller();
+    tout << "Frame interval: " << poller.interval_us() << " us"
+        << ", Frames: " << poller.frames()
+        << ", Duplicated: " << poller.duplicated()
+        << ", Skipped: " << poller.skipped()
+        << ", Retries: " << poller.retries() << '\n';
+
+    auto const& governor = m_lv_stream.governor();
+    tout << "Frame rate: " << governor.rate_fps() << " fps"
+        << (governor.is_throttling() ? " (throttled)" : "")
+        << ", Target: ";
+    if (0.0 < governor.target_fps()) {
+        tout << governor.target_fps() << " fps";
+    }
+    else {
+        tout << "camera rate";
+    }
+    tout << ", Backlog decreases: " << governor.backlog_decreases()
+        << ", Bandwidth decreases: " << governor.bandwidth_decreases() << '\n';
+
+    tout << "Live View Recording: " << (m_lv_writer.is_running() ? "running" : m_lv_writer.failed() ? "stopped after a write error" : "stopped")
+        << ", Frames: " << m_lv_writer.frames_written()
+        << ", Bytes: " << m_lv_writer.bytes_written()
+        << ", Batches: " << m_lv_writer.batches()
+        << ", Syncs: " << m_lv_writer.syncs()
+        << ", Dropped: " << m_lv_writer.dropped()
+        << ", Write errors: " << m_lv_writer.write_errors() << '\n';
+
+    tout << "Live View Server: ";
+    if (m_lv_http.is_running()) {
+        tout << "http://127.0.0.1:" << m_lv_http.port() << "/";
+    }
+    else {
+        tout << "stopped";
+    }
+    tout << ", Clients: " << m_lv_http.clients()
+        << ", Connections: " << m_lv_http.connections()
+        << ", Frames sent: " << m_lv_http.frames_sent() << '\n';
+
+    tout << "Live View Shared Memory: " << (m_lv_shm.is_running() ? m_lv_shm.name().c_str() : "stopped")
+        << ", Published: " << m_lv_shm.published()
+        << ", Oversized: " << m_lv_shm.oversized() << '\n';
 }
 
 void CameraDevice::get_live_view_image_quality()
 {
-    load_properties();
+    refresh_properties();
     tout << "Live View Image Quality: " << format_live_view_image_quality(m_prop.live_view_image_quality.current) << '\n';
 }
 
 void CameraDevice::get_select_media_format()
 {
-    load_properties();
+    refresh_properties();
     tout << "Media SLOT1 Full Format Enable Status: " << format_media_slotx_format_enable_status(m_prop.media_slot1_full_format_enable_status.current) << std::endl;
     tout << "Media SLOT2 Full Format Enable Status: " << format_media_slotx_format_enable_status(m_prop.media_slot2_full_format_enable_status.current) << std::endl;
     // Valid Quick format
@@ -596,14 +1391,14 @@ void CameraDevice::get_select_media_format()
 
 void CameraDevice::get_white_balance()
 {
-    load_properties();
+    refresh_properties();
     tout << "White Balance: " << format_white_balance(m_prop.white_balance.current) << '\n';
 }
 
 bool CameraDevice::get_custom_wb()
 {
     bool state = false;
-    load_properties();
+    refresh_properties();
     tout << "CustomWB Capture Standby Operation: " << format_customwb_capture_standby(m_prop.customwb_capture_standby.current) << '\n';
     tout << "CustomWB Capture Standby CancelOperation: " << format_customwb_capture_standby_cancel(m_prop.customwb_capture_standby_cancel.current) << '\n';
     tout << "CustomWB Capture Operation: " << format_customwb_capture_operation(m_prop.customwb_capture_operation.current) << '\n';
@@ -616,7 +1411,7 @@ bool CameraDevice::get_custom_wb()
 
 void CameraDevice::get_zoom_operation()
 {
-    load_properties();
+    refresh_properties();
     tout << "Zoom Operation Status: " << format_zoom_operation_status(m_prop.zoom_operation_status.current) << '\n';
     if (m_prop.zoom_setting_type.current > 0) {
         tout << "Zoom Setting Type    : " << format_zoom_setting_type(m_prop.zoom_setting_type.current) << '\n';
@@ -680,13 +1475,13 @@ void CameraDevice::get_zoom_operation()
 
 void CameraDevice::get_remocon_zoom_speed_type()
 {
-    load_properties();
+    refresh_properties();
     tout << "Zoom Speed Type: " << format_remocon_zoom_speed_type(m_prop.remocon_zoom_speed_type.current) << '\n';
 }
 
 bool CameraDevice::get_aps_c_or_full_switching_setting()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.aps_c_of_full_switching_setting.current < SDK::CrAPS_C_or_Full_SwitchingSetting::CrAPS_C_or_Full_SwitchingSetting_Full)
     {
         tout << "APS-C/FULL Switching Setting is not supported\n";
@@ -699,7 +1494,7 @@ bool CameraDevice::get_aps_c_or_full_switching_setting()
 
 bool CameraDevice::get_camera_setting_saveread_state()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.camera_setting_save_read_state.current == SDK::CrCameraSettingSaveReadState::CrCameraSettingSaveReadState_Reading) {
         tout << "Unable to download/upload Camera-Setting file. \n";
         return false;
@@ -710,7 +1505,7 @@ bool CameraDevice::get_camera_setting_saveread_state()
 
 bool CameraDevice::get_playback_media()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.playback_media.possible.size() < 1) {
         tout << "Playback Media is not supported\n";
         return false;
@@ -722,7 +1517,7 @@ bool CameraDevice::get_playback_media()
 
 bool CameraDevice::get_gain_base_sensitivity()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.gain_base_sensitivity.possible.size() < 1) {
         tout << "Gain Base Sensitivity is not supported\n";
         return false;
@@ -733,7 +1528,7 @@ bool CameraDevice::get_gain_base_sensitivity()
 
 bool CameraDevice::get_gain_base_iso_sensitivity()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.gain_base_iso_sensitivity.possible.size() < 1){
         tout << "Gain Base ISO Sensitivity is not supported \n";
         return false;
@@ -744,7 +1539,7 @@ bool CameraDevice::get_gain_base_iso_sensitivity()
 
 bool CameraDevice::get_monitor_lut_setting()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.monitor_lut_setting.possible.size() < 1) {
         tout << "Monitor LUT Setting is not supported \n";
         return false;
@@ -755,7 +1550,7 @@ bool CameraDevice::get_monitor_lut_setting()
 
 bool CameraDevice::get_exposure_index()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.exposure_index.possible.size() < 1) {
         tout << "Exposure Index is not supported \n";
         return false;
@@ -766,7 +1561,7 @@ bool CameraDevice::get_exposure_index()
 
 bool CameraDevice::get_baselook_value()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.baselook_value.possible.size() < 1) {
         tout << "BaseLook Value is not supported \n";
         return false;
@@ -797,7 +1592,7 @@ bool CameraDevice::get_baselook_value()
 
 bool CameraDevice::get_iris_mode_setting()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.iris_mode_setting.possible.size() < 1) {
         tout << "Iris Mode Setting is not supported \n";
         return false;
@@ -808,7 +1603,7 @@ bool CameraDevice::get_iris_mode_setting()
 
 bool CameraDevice::get_shutter_mode_setting()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.shutter_mode_setting.possible.size() < 1) {
         tout << "Shutter Mode Setting is not supported \n";
         return false;
@@ -819,7 +1614,7 @@ bool CameraDevice::get_shutter_mode_setting()
 
 void CameraDevice::get_iso_current_sensitivity()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.iso_current_sensitivity.current == 0) {
         tout << "ISO Current Sensitivity is not supported. \n";
         return;
@@ -829,7 +1624,7 @@ void CameraDevice::get_iso_current_sensitivity()
 
 bool CameraDevice::get_exposure_control_type()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.exposure_control_type.possible.size() < 1) {
         tout << "Exposure Control Type is not supported.\n";
         return false;
@@ -840,7 +1635,7 @@ bool CameraDevice::get_exposure_control_type()
 
 bool CameraDevice::get_gain_control_setting()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.gain_control_setting.possible.size() < 1) {
         tout << "Gain Control Setting is not supported.\n";
         return false;
@@ -851,7 +1646,7 @@ bool CameraDevice::get_gain_control_setting()
 
 bool CameraDevice::get_recording_setting()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.recording_setting.possible.size() < 1) {
         tout << "Recording Setting is not supported.\n";
         return false;
@@ -862,7 +1657,7 @@ bool CameraDevice::get_recording_setting()
 
 bool CameraDevice::get_gain_db_value()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.gain_db_value.possible.size() < 1) {
         tout << "Gain dB Value is not supported.\n";
         return false;
@@ -873,7 +1668,7 @@ bool CameraDevice::get_gain_db_value()
 
 bool CameraDevice::get_shutter_speed_value()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.shutter_speed_value.possible.size() < 1) {
         tout << "Shutter Speed Value is not supported.\n";
         return false;
@@ -884,7 +1679,7 @@ bool CameraDevice::get_shutter_speed_value()
 
 bool CameraDevice::get_white_balance_tint()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.white_balance_tint.possible.size() < 1)
     {
         tout << "White Balance Tint is not supported.\n";
@@ -903,7 +1698,7 @@ bool CameraDevice::get_white_balance_tint()
 
 void CameraDevice::get_media_slot_status()
 {
-    load_properties();
+    refresh_properties();
 
     // SLOT1
     tout << "Media SLOT1 Status                  : " << format_media_slotx_status((uint8_t)m_prop.media_slot1_status.current) << std::endl;
@@ -944,7 +1739,7 @@ void CameraDevice::get_media_slot_status()
 
 bool CameraDevice::get_movie_rec_button_toggle_enable_status()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.movie_rec_button_toggle_enable_status.writable == -1)
     {
         tout << "Movie Rec Button(Toggle) is not supported\n";
@@ -956,7 +1751,7 @@ bool CameraDevice::get_movie_rec_button_toggle_enable_status()
 
 bool CameraDevice::get_focus_bracket_shot_num()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.focus_bracket_shot_num.possible.size() < 3)
     {
         tout << "Focus Bracket Shot Number is not supported \n";
@@ -970,7 +1765,7 @@ bool CameraDevice::get_focus_bracket_shot_num()
 
 bool CameraDevice::get_focus_bracket_focus_range()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.focus_bracket_focus_range.possible.size() < 3)
     {
         tout << "Focus Bracket Focus Range is not supported \n";
@@ -984,7 +1779,7 @@ bool CameraDevice::get_focus_bracket_focus_range()
 
 bool CameraDevice::get_movie_image_stabilization_steady_shot()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.movie_image_stabilization_steady_shot.possible.size() < 1) {
         tout << "Image Stabilization Steady Shot(Movie) is not supported.\n";
         return false;
@@ -995,7 +1790,7 @@ bool CameraDevice::get_movie_image_stabilization_steady_shot()
 
 bool CameraDevice::get_image_stabilization_steady_shot()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.image_stabilization_steady_shot.possible.size() < 1) {
         tout << "Image Stabilization Steady Shot(Still) is not supported.\n";
         return false;
@@ -1006,7 +1801,7 @@ bool CameraDevice::get_image_stabilization_steady_shot()
 
 bool CameraDevice::get_silent_mode()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.silent_mode.possible.size() < 1) {
         tout << "Silent Mode is not supported.\n";
         return false;
@@ -1017,7 +1812,7 @@ bool CameraDevice::get_silent_mode()
 
 bool CameraDevice::get_silent_mode_aperture_drive_in_af()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.silent_mode_aperture_drive_in_af.possible.size() < 1) {
         tout << "Silent Mode Aperture Drive in AF is not supported.\n";
         return false;
@@ -1028,7 +1823,7 @@ bool CameraDevice::get_silent_mode_aperture_drive_in_af()
 
 bool CameraDevice::get_silent_mode_shutter_when_power_off()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.silent_mode_shutter_when_power_off.possible.size() < 1) {
         tout << "Silent Mode Shutter When Power OFF is not supported.\n";
         return false;
@@ -1039,7 +1834,7 @@ bool CameraDevice::get_silent_mode_shutter_when_power_off()
 
 bool CameraDevice::get_silent_mode_auto_pixel_mapping()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.silent_mode_auto_pixel_mapping.possible.size() < 1) {
         tout << "Silent Mode Auto Pixel Mapping is not supported.\n";
         return false;
@@ -1050,7 +1845,7 @@ bool CameraDevice::get_silent_mode_auto_pixel_mapping()
 
 bool CameraDevice::get_shutter_type()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.shutter_type.possible.size() < 1)
     {
         tout << "Shutter Type is not supported.\n";
@@ -1062,7 +1857,7 @@ bool CameraDevice::get_shutter_type()
 
 bool CameraDevice::get_movie_shooting_mode()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.movie_shooting_mode.possible.size() < 1) {
         tout << "Movie Shooting Mode is not supported.\n";
         return false;
@@ -1090,7 +1885,7 @@ void CameraDevice::set_aperture()
     tout << "Choose a number set a new Aperture value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.f_number.possible;
+    auto const values = m_prop.f_number.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_f_number(values[i]) << '\n';
     }
@@ -1114,7 +1909,7 @@ void CameraDevice::set_aperture()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_iso()
@@ -1136,7 +1931,7 @@ void CameraDevice::set_iso()
     tout << "Choose a number set a new ISO value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.iso_sensitivity.possible;
+    auto const values = m_prop.iso_sensitivity.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_iso_sensitivity(values[i]) << '\n';
     }
@@ -1160,7 +1955,7 @@ void CameraDevice::set_iso()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 bool CameraDevice::set_save_info() const
@@ -1207,7 +2002,7 @@ void CameraDevice::set_shutter_speed()
     tout << "Choose a number set a new Shutter Speed value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.shutter_speed.possible;
+    auto const values = m_prop.shutter_speed.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_shutter_speed(values[i]) << '\n';
     }
@@ -1231,7 +2026,7 @@ void CameraDevice::set_shutter_speed()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_position_key_setting()
@@ -1253,7 +2048,7 @@ void CameraDevice::set_position_key_setting()
     tout << "Choose a number set a new Position Key Setting value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.position_key_setting.possible;
+    auto const values = m_prop.position_key_setting.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_position_key_setting(values[i]) << '\n';
     }
@@ -1277,7 +2072,7 @@ void CameraDevice::set_position_key_setting()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_exposure_program_mode()
@@ -1299,7 +2094,7 @@ void CameraDevice::set_exposure_program_mode()
     tout << "Choose a number set a new Exposure Program Mode value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.exposure_program_mode.possible;
+    auto const values = m_prop.exposure_program_mode.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_exposure_program_mode(values[i]) << '\n';
     }
@@ -1323,7 +2118,7 @@ void CameraDevice::set_exposure_program_mode()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_still_capture_mode()
@@ -1345,7 +2140,7 @@ void CameraDevice::set_still_capture_mode()
     tout << "Choose a number set a new Still Capture Mode value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.still_capture_mode.possible;
+    auto const values = m_prop.still_capture_mode.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_still_capture_mode(values[i]) << '\n';
     }
@@ -1369,7 +2164,7 @@ void CameraDevice::set_still_capture_mode()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_focus_mode()
@@ -1391,7 +2186,7 @@ void CameraDevice::set_focus_mode()
     tout << "Choose a number set a new Focus Mode value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.focus_mode.possible;
+    auto const values = m_prop.focus_mode.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_focus_mode(values[i]) << '\n';
     }
@@ -1415,7 +2210,7 @@ void CameraDevice::set_focus_mode()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_focus_area()
@@ -1437,7 +2232,7 @@ void CameraDevice::set_focus_area()
     tout << "Choose a number set a new Focus Area value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.focus_area.possible;
+    auto const values = m_prop.focus_area.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_focus_area(values[i]) << '\n';
     }
@@ -1461,7 +2256,7 @@ void CameraDevice::set_focus_area()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_live_view_image_quality()
@@ -1483,7 +2278,7 @@ void CameraDevice::set_live_view_image_quality()
     tout << "Choose a number set a new Live View Image Quality value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.live_view_image_quality.possible;
+    auto const values = m_prop.live_view_image_quality.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_live_view_image_quality(values[i]) << '\n';
     }
@@ -1507,7 +2302,7 @@ void CameraDevice::set_live_view_image_quality()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_white_balance()
@@ -1529,7 +2324,7 @@ void CameraDevice::set_white_balance()
     tout << std::endl << "Choose a number set a new White Balance value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.white_balance.possible;
+    auto const values = m_prop.white_balance.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_white_balance(values[i]) << '\n';
     }
@@ -1553,12 +2348,12 @@ void CameraDevice::set_white_balance()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::execute_lock_property(CrInt16u code)
 {
-    load_properties();
+    refresh_properties();
 
     text input;
     tout << std::endl << "Would you like to execute Unlock or Lock? (y/n): ";
@@ -1606,7 +2401,7 @@ void CameraDevice::execute_lock_property(CrInt16u code)
     prop.SetCurrentValue((CrInt64u)(ptpValue));
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::get_af_area_position()
@@ -1661,7 +2456,7 @@ void CameraDevice::get_af_area_position()
 
 void CameraDevice::set_af_area_position()
 {
-    load_properties();
+    refresh_properties();
 
     if (1 == m_prop.position_key_setting.writable) {
         // Set, PriorityKeySettings property
@@ -1670,12 +2465,12 @@ void CameraDevice::set_af_area_position()
         priority.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings);
         priority.SetCurrentValue(SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote);
         priority.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
-        auto err_priority = SDK::SetDeviceProperty(m_device_handle, &priority);
+        auto err_priority = set_property(priority);
         if (CR_FAILED(err_priority)) {
             tout << "Priority Key setting FAILED\n";
             return;
         }
-        std::this_thread::sleep_for(500ms);
+        await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings, SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote, 500ms);
         get_position_key_setting();
     }
 
@@ -1690,15 +2485,14 @@ void CameraDevice::set_af_area_position()
     int i = 0;
     while (i < 5)
     {
-        err_expromode = SDK::SetDeviceProperty(m_device_handle, &expromode);
+        err_expromode = set_property(expromode);
         if (CR_FAILED(err_expromode)) {
             tout << "Exposure Program mode FAILED\n";
             return;
         }
-        std::this_thread::sleep_for(1000ms);
+        execStat = await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureProgramMode, SDK::CrExposureProgram::CrExposure_P_Auto, 1000ms);
         get_exposure_program_mode();
-        if (m_prop.exposure_program_mode.current == SDK::CrExposureProgram::CrExposure_P_Auto) {
-            execStat = true;
+        if (execStat) {
             break;
         }
         i++;
@@ -1725,7 +2519,7 @@ void CameraDevice::set_af_area_position()
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
     auto& values = m_prop.focus_area.possible;
-    if(find(values.begin(), values.end(), SDK::CrFocusArea::CrFocusArea_Flexible_Spot_S) != values.end()) {
+    if(std::find(values.begin(), values.end(), SDK::CrFocusArea::CrFocusArea_Flexible_Spot_S) != values.end()) {
         prop.SetCurrentValue(SDK::CrFocusArea::CrFocusArea_Flexible_Spot_S);
     }
     else {
@@ -1734,20 +2528,18 @@ void CameraDevice::set_af_area_position()
         return;
     }
 
-    auto err_prop = SDK::SetDeviceProperty(m_device_handle, &prop);
     execStat = false;
     i = 0;
     while (i < 5)
     {
-        err_expromode = SDK::SetDeviceProperty(m_device_handle, &prop);
+        auto err_prop = set_property(prop);
         if (CR_FAILED(err_prop)) {
             tout << "Focus Area FAILED\n";
             return;
         }
-        std::this_thread::sleep_for(1000ms);
+        execStat = await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_FocusArea, SDK::CrFocusArea::CrFocusArea_Flexible_Spot_S, 1000ms);
         get_focus_area();
-        if (m_prop.focus_area.current == SDK::CrFocusArea::CrFocusArea_Flexible_Spot_S) {
-            execStat = true;
+        if (execStat) {
             break;
         }
         i++;
@@ -1911,7 +2703,7 @@ void CameraDevice::set_select_media_format()
 
 void CameraDevice::execute_movie_rec()
 {
-    load_properties();
+    refresh_properties();
 
     text input;
     tout << std::endl << "Operate the movie recording button ? (y/n): ";
@@ -1965,7 +2757,7 @@ void CameraDevice::execute_movie_rec()
 
 void CameraDevice::set_custom_wb()
 {
-    load_properties();
+    refresh_properties();
     if (-1 == m_prop.customwb_capture_execution_state.writable) {
         tout << "Custom WB Capture is Not Supported.\n";
         return ;
@@ -1977,12 +2769,12 @@ void CameraDevice::set_custom_wb()
         priority.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings);
         priority.SetCurrentValue(SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote);
         priority.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
-        auto err_priority = SDK::SetDeviceProperty(m_device_handle, &priority);
+        auto err_priority = set_property(priority);
         if (CR_FAILED(err_priority)) {
             tout << "Priority Key setting FAILED\n";
             return;
         }
-        std::this_thread::sleep_for(500ms);
+        await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings, SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote, 500ms);
         get_position_key_setting();
     }
 
@@ -1997,15 +2789,14 @@ void CameraDevice::set_custom_wb()
     int i = 0;
     while (i < 5)
     {
-        err_expromode = SDK::SetDeviceProperty(m_device_handle, &expromode);
+        err_expromode = set_property(expromode);
         if (CR_FAILED(err_expromode)) {
             tout << "Exposure Program mode FAILED\n";
             return;
         }
-        std::this_thread::sleep_for(1000ms);
+        execStat = await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureProgramMode, SDK::CrExposureProgram::CrExposure_P_Auto, 1000ms);
         get_exposure_program_mode();
-        if (m_prop.exposure_program_mode.current == SDK::CrExposureProgram::CrExposure_P_Auto) {
-            execStat = true;
+        if (execStat) {
             break;
         }
         i++;
@@ -2023,12 +2814,12 @@ void CameraDevice::set_custom_wb()
     wb.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalance);
     wb.SetCurrentValue(SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_1);
     wb.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
-    auto err_wb = SDK::SetDeviceProperty(m_device_handle, &wb);
+    auto err_wb = set_property(wb);
     if (CR_FAILED(err_wb)) {
         tout << "White Balance FAILED\n";
         return;
     }
-    std::this_thread::sleep_for(2000ms);
+    await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalance, SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_1, 2000ms);
     get_white_balance();
 
     execStat = false;
@@ -2039,7 +2830,7 @@ void CameraDevice::set_custom_wb()
     while ((false == execStat) && (i < 5))
     {
         execute_downup_property(SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Standby);
-        std::this_thread::sleep_for(1000ms);
+        await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Operation, SDK::CrPropertyCustomWBOperation_Enable, 1000ms);
         tout << std::endl;
         execStat = get_custom_wb();
         i++;
@@ -2056,7 +2847,15 @@ void CameraDevice::set_custom_wb()
     tout << std::endl << "Set custom WB capture ";
     execute_pos_xy(SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture);
 
-    std::this_thread::sleep_for(5000ms);
+    // Done once the camera has been seen capturing and has left that state
+    bool capturing = false;
+    await_property(SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Execution_State, [&capturing](CrInt64u state) {
+        if (SDK::CrPropertyCustomWBExecutionState_Capturing == state) {
+            capturing = true;
+            return false;
+        }
+        return capturing;
+    }, 5000ms);
 
     // Set, custom WB capture standby cancel 
     text input;
@@ -2151,7 +2950,7 @@ void CameraDevice::set_zoom_operation()
         prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Operation);
         prop.SetCurrentValue((CrInt64u)ptpValue);
         prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
-        SDK::SetDeviceProperty(m_device_handle, &prop);
+        set_property(prop);
         if (cancel == true) {
             return;
         }
@@ -2178,7 +2977,7 @@ void CameraDevice::set_remocon_zoom_speed_type()
     tout << "Choose a number set a new zoom speed type value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.remocon_zoom_speed_type.possible;
+    auto const values = m_prop.remocon_zoom_speed_type.values();
 
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_remocon_zoom_speed_type(values[i]) << '\n';
@@ -2203,7 +3002,7 @@ void CameraDevice::set_remocon_zoom_speed_type()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 bool CameraDevice::set_drive_mode(CrInt64u Value)
@@ -2212,7 +3011,7 @@ bool CameraDevice::set_drive_mode(CrInt64u Value)
     mode.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_DriveMode);
     mode.SetCurrentValue(Value);
     mode.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
-    auto err_still_capture_mode = SDK::SetDeviceProperty(m_device_handle, &mode);
+    auto err_still_capture_mode = set_property(mode);
     if (CR_FAILED(err_still_capture_mode)) {
         return false;
     }
@@ -2223,7 +3022,7 @@ bool CameraDevice::set_drive_mode(CrInt64u Value)
 
 void CameraDevice::execute_camera_setting_reset()
 {
-    load_properties();
+    refresh_properties();
     if (SDK::CrCameraSettingsResetEnableStatus::CrCameraSettingsReset_Enable == m_prop.camera_setting_reset_enable_status.current) {
         tout << "Camera Setting Reset Enable Status: Enable \n";
     } else {
@@ -2289,7 +3088,7 @@ void CameraDevice::set_playback_media()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_PlaybackMedia);
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_gain_base_sensitivity()
@@ -2333,7 +3132,7 @@ void CameraDevice::set_gain_base_sensitivity()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_GainBaseSensitivity);
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_gain_base_iso_sensitivity()
@@ -2378,7 +3177,7 @@ void CameraDevice::set_gain_base_iso_sensitivity()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_GainBaseIsoSensitivity);
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_monitor_lut_setting()
@@ -2421,7 +3220,7 @@ void CameraDevice::set_monitor_lut_setting()
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_exposure_index()
@@ -2445,7 +3244,7 @@ void CameraDevice::set_exposure_index()
     tout << "Choose a number set a new Exposure Index:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.exposure_index.possible;
+    auto const values = m_prop.exposure_index.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << values[i] << '\n';
     }
@@ -2467,7 +3266,7 @@ void CameraDevice::set_exposure_index()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureIndex);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_baselook_value()
@@ -2536,7 +3335,7 @@ void CameraDevice::set_baselook_value()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_BaseLookValue);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
  }
 
 void CameraDevice::set_iris_mode_setting()
@@ -2581,7 +3380,7 @@ void CameraDevice::set_iris_mode_setting()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_IrisModeSetting);
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_shutter_mode_setting()
@@ -2626,7 +3425,7 @@ void CameraDevice::set_shutter_mode_setting()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterModeSetting);
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_exposure_control_type()
@@ -2671,7 +3470,7 @@ void CameraDevice::set_exposure_control_type()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureCtrlType);
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_recording_setting()
@@ -2696,7 +3495,7 @@ void CameraDevice::set_recording_setting()
     tout << "Choose a number set a new Recording Setting is value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.recording_setting.possible;
+    auto const values = m_prop.recording_setting.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_recording_setting(values[i]) << '\n';
     }
@@ -2720,7 +3519,7 @@ void CameraDevice::set_recording_setting()
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_gain_control_setting()
@@ -2765,12 +3564,12 @@ void CameraDevice::set_gain_control_setting()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_GainControlSetting);
     prop.SetCurrentValue((CrInt64u)ptpValue);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_dispmode()
 {
-    load_properties();
+    refresh_properties();
     if (-1 == m_prop.dispmode_candidate.writable||
         -1 == m_prop.dispmode_setting.writable||
         -1 == m_prop.dispmode.writable) {
@@ -2816,7 +3615,7 @@ void CameraDevice::set_dispmode()
     disp_state_prop.SetCurrentValue((CrInt64u)set_dispmode_setting);
     disp_state_prop.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &disp_state_prop);
+    set_property(disp_state_prop);
 
     std::this_thread::sleep_for(500ms);
 
@@ -2826,7 +3625,7 @@ void CameraDevice::set_dispmode()
     disp_mode_prop.SetCurrentValue((CrInt64u)set_dispmode);
     disp_mode_prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
 
-    SDK::SetDeviceProperty(m_device_handle, &disp_mode_prop);
+    set_property(disp_mode_prop);
 }
 
 void CameraDevice::set_gain_db_value()
@@ -2864,7 +3663,7 @@ void CameraDevice::set_gain_db_value()
     prop.SetCurrentValue((CrInt64u)num);
     prop.SetValueType(SDK::CrDataType::CrDataType_Int8);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_white_balance_tint()
@@ -2935,7 +3734,7 @@ void CameraDevice::set_white_balance_tint()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalanceTintStep);
     prop.SetCurrentValue((CrInt64u)num);
     prop.SetValueType(SDK::CrDataType::CrDataType_Int16);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_shutter_speed_value()
@@ -2960,7 +3759,7 @@ void CameraDevice::set_shutter_speed_value()
     tout << "Choose a number set a new Shutter Speed value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.shutter_speed_value.possible;
+    auto const values = m_prop.shutter_speed_value.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_shutter_speed_value(values[i]) << '\n';
     }
@@ -2983,7 +3782,7 @@ void CameraDevice::set_shutter_speed_value()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterSpeedValue);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt64Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_focus_bracket_shot_num()
@@ -3021,7 +3820,7 @@ void CameraDevice::set_focus_bracket_shot_num()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_FocusBracketShotNumber);
     prop.SetCurrentValue((CrInt64u)num);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_focus_bracket_focus_range()
@@ -3059,7 +3858,7 @@ void CameraDevice::set_focus_bracket_focus_range()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_FocusBracketFocusRange);
     prop.SetCurrentValue((CrInt64u)num);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_image_stabilization_steady_shot()
@@ -3084,7 +3883,7 @@ void CameraDevice::set_image_stabilization_steady_shot()
     tout << "Choose a number set a new Image Stabilization Steady Shot(Still) value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.image_stabilization_steady_shot.possible;
+    auto const values = m_prop.image_stabilization_steady_shot.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_image_stabilization_steady_shot(values[i]) << '\n';
     }
@@ -3107,7 +3906,7 @@ void CameraDevice::set_image_stabilization_steady_shot()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_ImageStabilizationSteadyShot);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_movie_image_stabilization_steady_shot()
@@ -3132,7 +3931,7 @@ void CameraDevice::set_movie_image_stabilization_steady_shot()
     tout << "Choose a number set a new Image Stabilization Steady Shot(Movie) value:\n\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.movie_image_stabilization_steady_shot.possible;
+    auto const values = m_prop.movie_image_stabilization_steady_shot.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_movie_image_stabilization_steady_shot(values[i]) << '\n';
     }
@@ -3154,7 +3953,7 @@ void CameraDevice::set_movie_image_stabilization_steady_shot()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_Movie_ImageStabilizationSteadyShot);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_silent_mode() {
@@ -3179,7 +3978,7 @@ void CameraDevice::set_silent_mode() {
     tout << "Choose a number set a new Silent Mode value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.silent_mode.possible;
+    auto const values = m_prop.silent_mode.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_silent_mode(values[i]) << '\n';
     }
@@ -3202,7 +4001,7 @@ void CameraDevice::set_silent_mode() {
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_SilentMode);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_silent_mode_aperture_drive_in_af()
@@ -3228,7 +4027,7 @@ void CameraDevice::set_silent_mode_aperture_drive_in_af()
     tout << "Choose a number set a new Aperture Drive in AF value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.silent_mode_aperture_drive_in_af.possible;
+    auto const values = m_prop.silent_mode_aperture_drive_in_af.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_silent_mode_aperture_drive_in_af(values[i]) << '\n';
     }
@@ -3251,7 +4050,7 @@ void CameraDevice::set_silent_mode_aperture_drive_in_af()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeApertureDriveInAF);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_silent_mode_shutter_when_power_off()
@@ -3277,7 +4076,7 @@ void CameraDevice::set_silent_mode_shutter_when_power_off()
     tout << "Choose a number set a new Shutter When Power OFF value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.silent_mode_shutter_when_power_off.possible;
+    auto const values = m_prop.silent_mode_shutter_when_power_off.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_silent_mode_shutter_when_power_off(values[i]) << '\n';
     }
@@ -3300,7 +4099,7 @@ void CameraDevice::set_silent_mode_shutter_when_power_off()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeShutterWhenPowerOff);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_silent_mode_auto_pixel_mapping()
@@ -3326,7 +4125,7 @@ void CameraDevice::set_silent_mode_auto_pixel_mapping()
     tout << "Choose a number set a new Auto Pixel Mapping value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.silent_mode_auto_pixel_mapping.possible;
+    auto const values = m_prop.silent_mode_auto_pixel_mapping.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_silent_mode_auto_pixel_mapping(values[i]) << '\n';
     }
@@ -3349,7 +4148,7 @@ void CameraDevice::set_silent_mode_auto_pixel_mapping()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeAutoPixelMapping);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_shutter_type()
@@ -3374,7 +4173,7 @@ void CameraDevice::set_shutter_type()
     tout << "Choose a number set a new Shutter Type value:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.shutter_type.possible;
+    auto const values = m_prop.shutter_type.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_shutter_type(values[i]) << '\n';
     }
@@ -3397,7 +4196,7 @@ void CameraDevice::set_shutter_type()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterType);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::set_movie_shooting_mode()
@@ -3422,7 +4221,7 @@ void CameraDevice::set_movie_shooting_mode()
     tout << "Choose a number set a new Movie Shooting Mode:\n";
     tout << "[-1] Cancel input\n";
 
-    auto& values = m_prop.movie_shooting_mode.possible;
+    auto const values = m_prop.movie_shooting_mode.values();
     for (std::size_t i = 0; i < values.size(); ++i) {
         tout << '[' << i << "] " << format_movie_shooting_mode(values[i]) << '\n';
     }
@@ -3445,7 +4244,7 @@ void CameraDevice::set_movie_shooting_mode()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_MovieShootingMode);
     prop.SetCurrentValue(values[selected_index]);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16Array);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::execute_downup_property(CrInt16u code)
@@ -3456,20 +4255,20 @@ void CameraDevice::execute_downup_property(CrInt16u code)
 
     // Down
     prop.SetCurrentValue(SDK::CrPropertyCustomWBCaptureButton::CrPropertyCustomWBCapture_Down);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 
     std::this_thread::sleep_for(500ms);
 
     // Up
     prop.SetCurrentValue(SDK::CrPropertyCustomWBCaptureButton::CrPropertyCustomWBCapture_Up);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 
     std::this_thread::sleep_for(500ms);
 }
 
 void CameraDevice::execute_pos_xy(CrInt16u code)
 {
-    load_properties();
+    refresh_properties();
 
     text input;
     tout << std::endl << "Change position ? (y/n): ";
@@ -3523,12 +4322,12 @@ void CameraDevice::execute_pos_xy(CrInt16u code)
     prop.SetCurrentValue((CrInt64u)x_y);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt32);
 
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::execute_preset_focus()
 {
-    load_properties();
+    refresh_properties();
 
     auto& values_save = m_prop.save_zoom_and_focus_position.possible;
     auto& values_load = m_prop.load_zoom_and_focus_position.possible;
@@ -3589,13 +4388,13 @@ void CameraDevice::execute_preset_focus()
     ss_slot >> input_value;
 
     if (code == SDK::CrDevicePropertyCode::CrDeviceProperty_ZoomAndFocusPosition_Save) {
-        if (find(values_save.begin(), values_save.end(), input_value) == values_save.end()) {
+        if (std::find(values_save.begin(), values_save.end(), input_value) == values_save.end()) {
             tout << "Input cancelled.\n";
             return;
         }
     }
     else {
-        if (find(values_load.begin(), values_load.end(), input_value) == values_load.end()) {
+        if (std::find(values_load.begin(), values_load.end(), input_value) == values_load.end()) {
             tout << "Input cancelled.\n";
             return;
         }
@@ -3605,7 +4404,7 @@ void CameraDevice::execute_preset_focus()
     prop.SetCode(code);
     prop.SetCurrentValue(input_value);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt8);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 }
 
 void CameraDevice::execute_APS_C_or_Full()
@@ -3695,7 +4494,7 @@ void CameraDevice::execute_movie_rec_toggle()
 
 void CameraDevice::execute_focus_bracket()
 {
-    load_properties();
+    refresh_properties();
 
     if (1 != m_prop.focus_bracket_shot_num.writable || 1 != m_prop.focus_bracket_focus_range.writable) {
         tout << "Focus Bracket Shooting is not executable\n";
@@ -3709,7 +4508,7 @@ void CameraDevice::execute_focus_bracket()
     priority.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings);
     priority.SetCurrentValue(SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote);
     priority.SetValueType(SDK::CrDataType::CrDataType_UInt32Array);
-    auto err_priority = SDK::SetDeviceProperty(m_device_handle, &priority);
+    auto err_priority = set_property(priority);
     if (CR_FAILED(err_priority)) {
         tout << "Priority Key setting FAILED\n";
         return;
@@ -3725,22 +4524,12 @@ void CameraDevice::execute_focus_bracket()
         return;
     }
 
-    bool continueFlag = false;
-    for (int i = 0; i < 10; i++)
-    {
-        tout << ". ";
-        std::this_thread::sleep_for(500ms);
-        load_properties();
-        if (SDK::CrDriveMode::CrDrive_FocusBracket == m_prop.still_capture_mode.current) {
-            tout << "\nStill Capture Mode setting SUCCESS\n";
-            continueFlag = true;
-            break;
-        }
-    }
+    bool continueFlag = await_property_value(SDK::CrDevicePropertyCode::CrDeviceProperty_DriveMode, SDK::CrDriveMode::CrDrive_FocusBracket, 5000ms);
     if (false == continueFlag) {
         tout << "\nStill Capture Mode setting FAILED\n";
         return;
     }
+    tout << "\nStill Capture Mode setting SUCCESS\n";
 
     capture_image();
 }
@@ -4008,6 +4797,9 @@ text CameraDevice::get_id()
 void CameraDevice::OnConnected(SDK::DeviceConnectionVersioin version)
 {
     m_connected.store(true);
+    m_prop_changes.invalidate();
+    m_prop_subscriptions.invalidate();
+    m_lv_overlay.clear(); // on the callback thread, like every overlay update
     text id(this->get_id());
     tout << "Connected to " << m_info->GetModel() << " (" << id.data() << ")\n";
 }
@@ -4178,6 +4970,9 @@ void CameraDevice::OnWarningExt(CrInt32u warning, CrInt32 param1, CrInt32 param2
 
 void CameraDevice::OnPropertyChangedCodes(CrInt32u num, CrInt32u* codes)
 {
+    m_prop_history.reported(num, codes);
+    m_prop_changes.push(num, codes);
+    m_prop_subscriptions.changed(num, codes);
     //tout << "Property changed.  num = " << std::dec << num;
     //tout << std::hex;
     //for (std::int32_t i = 0; i < num; ++i)
@@ -4196,141 +4991,14 @@ void CameraDevice::OnLvPropertyChangedCodes(CrInt32u num, CrInt32u* codes)
     //    tout << ", 0x" << codes[i];
     //}
     //tout << std::endl;
-#if 0 
+    // Decode only, the overlay is formatted by whoever reads it
     SDK::CrLiveViewProperty* lvProperty = nullptr;
     int32_t nprop = 0;
     SDK::CrError err = SDK::GetSelectLiveViewProperties(m_device_handle, num, codes, &lvProperty, &nprop);
     if (CR_SUCCEEDED(err) && lvProperty) {
-        for (int32_t i=0 ; i<nprop ; i++) {
-            auto prop = lvProperty[i];
-            if (SDK::CrFrameInfoType::CrFrameInfoType_FocusFrameInfo == prop.GetFrameInfoType()) {
-                int sizVal = prop.GetValueSize();
-                int count = sizVal / sizeof(SDK::CrFocusFrameInfo);
-                SDK::CrFocusFrameInfo* pFrameInfo = (SDK::CrFocusFrameInfo*)prop.GetValue();
-                if (0 == sizVal || nullptr == pFrameInfo) {
-                    tout << "  FocusFrameInfo nothing\n";
-                }
-                else {
-                    for (std::int32_t frame = 0; frame < count; ++frame) {
-                        auto lvprop = pFrameInfo[frame];
-                        char buff[512];
-                        memset(buff, 0, sizeof(buff));
-#if defined(_WIN32) || (_WIN64)
-                        sprintf_s(buff, "  FocusFrameInfo no[%d] type[%d] state[%d] w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                            frame + 1,
-                            lvprop.type,
-                            lvprop.state,
-                            lvprop.width, lvprop.height,
-                            lvprop.xDenominator, lvprop.yDenominator,
-                            lvprop.xNumerator, lvprop.yNumerator);
-#else
-                        snprintf(buff, sizeof(buff), "  FocusFrameInfo no[%d] type[%d] state[%d] w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                            frame + 1,
-                            lvprop.type,
-                            lvprop.state,
-                            lvprop.width, lvprop.height,
-                            lvprop.xDenominator, lvprop.yDenominator,
-                            lvprop.xNumerator, lvprop.yNumerator);
-#endif                           
-                        tout << buff << std::endl;
-                    }
-                }
-            }
-            else if (SDK::CrFrameInfoType::CrFrameInfoType_FaceFrameInfo == prop.GetFrameInfoType()) {
-                int sizVal = prop.GetValueSize();
-                int count = sizVal / sizeof(SDK::CrFaceFrameInfo);
-                SDK::CrFaceFrameInfo* pFrameInfo = (SDK::CrFaceFrameInfo*)prop.GetValue();
-                if (0 == sizVal || nullptr == pFrameInfo) {
-                    tout << "  FaceFrameInfo nothing\n";
-                }
-                else {
-                    for (std::int32_t frame = 0; frame < count; ++frame) {
-                        auto lvprop = pFrameInfo[frame];
-                        char buff[512];
-                        memset(buff, 0, sizeof(buff));
-#if defined(_WIN32) || (_WIN64)
-                        sprintf_s(buff, "  FaceFrameInfo no[%d] type[%d] state[%d] w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                            frame + 1,
-                            lvprop.type,
-                            lvprop.state,
-                            lvprop.width, lvprop.height,
-                            lvprop.xDenominator, lvprop.yDenominator,
-                            lvprop.xNumerator, lvprop.yNumerator);
-#else
-                        snprintf(buff, sizeof(buff), "  FaceFrameInfo no[%d] type[%d] state[%d] w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                            frame + 1,
-                            lvprop.type,
-                            lvprop.state,
-                            lvprop.width, lvprop.height,
-                            lvprop.xDenominator, lvprop.yDenominator,
-                            lvprop.xNumerator, lvprop.yNumerator);
-#endif                           
-                        tout << buff << std::endl;
-                    }
-                }
-            }
-            else if (SDK::CrFrameInfoType::CrFrameInfoType_TrackingFrameInfo == prop.GetFrameInfoType()) {
-                int sizVal = prop.GetValueSize();
-                int count = sizVal / sizeof(SDK::CrTrackingFrameInfo);
-                SDK::CrTrackingFrameInfo* pFrameInfo = (SDK::CrTrackingFrameInfo*)prop.GetValue();
-                if (0 == sizVal || nullptr == pFrameInfo) {
-                    tout << "  TrackingFrameInfo nothing\n";
-                }
-                else {
-                    for (std::int32_t frame = 0; frame < count; ++frame) {
-                        auto lvprop = pFrameInfo[frame];
-                        char buff[512];
-                        memset(buff, 0, sizeof(buff));
-#if defined(_WIN32) || (_WIN64)
-                        sprintf_s(buff, "  TrackingFrameInfo no[%d] type[%d] state[%d] w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                            frame + 1,
-                            lvprop.type,
-                            lvprop.state,
-                            lvprop.width, lvprop.height,
-                            lvprop.xDenominator, lvprop.yDenominator,
-                            lvprop.xNumerator, lvprop.yNumerator);
-#else
-                        snprintf(buff, sizeof(buff), "  TrackingFrameInfo no[%d] type[%d] state[%d] w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                            frame + 1,
-                            lvprop.type,
-                            lvprop.state,
-                            lvprop.width, lvprop.height,
-                            lvprop.xDenominator, lvprop.yDenominator,
-                            lvprop.xNumerator, lvprop.yNumerator);
-#endif                           
-                        tout << buff << std::endl;
-                    }
-                }
-            }
-            else if (SDK::CrFrameInfoType::CrFrameInfoType_Magnifier_Position == prop.GetFrameInfoType()) {
-                int sizVal = prop.GetValueSize();
-                int count = sizVal / sizeof(SDK::CrMagPosInfo);
-                SDK::CrMagPosInfo* pMagPosInfo = (SDK::CrMagPosInfo*)prop.GetValue();
-                if (0 == sizVal || nullptr == pMagPosInfo) {
-                    tout << "  MagPosInfo nothing\n";
-                }
-                else {
-                    char buff[512];
-                    memset(buff, 0, sizeof(buff));
-#if defined(_WIN32) || (_WIN64)
-                    sprintf_s(buff, "  MagPosInfo w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                        pMagPosInfo->width, pMagPosInfo->height,
-                        pMagPosInfo->xDenominator, pMagPosInfo->yDenominator,
-                        pMagPosInfo->xNumerator, pMagPosInfo->yNumerator);
-#else
-                    snprintf(buff, sizeof(buff), "  MagPosInfo w[%d] h[%d] Deno[%d-%d] Nume[%d-%d]",
-                        pMagPosInfo->width, pMagPosInfo->height,
-                        pMagPosInfo->xDenominator, pMagPosInfo->yDenominator,
-                        pMagPosInfo->xNumerator, pMagPosInfo->yNumerator);
-#endif
-                    tout << buff << std::endl;
-                }
-            }
-        }
+        m_lv_overlay.update(lvProperty, nprop);
         SDK::ReleaseLiveViewProperties(m_device_handle, lvProperty);
     }
-#endif
-    tout << std::dec;
 }
 
 void CameraDevice::OnError(CrInt32u error)
@@ -4364,14 +5032,83 @@ void CameraDevice::OnError(CrInt32u error)
     }
 }
 
-void CameraDevice::load_properties(CrInt32u num, CrInt32u* codes)
+void CameraDevice::refresh_properties()
+{
+    switch (m_prop_changes.take(m_prop_refresh_codes)) {
+    case PropertyChangeQueue::Refresh::All:
+        if (!load_properties()) {
+            m_prop_changes.invalidate();
+        }
+        break;
+    case PropertyChangeQueue::Refresh::Codes:
+        if (!load_properties(static_cast<CrInt32u>(m_prop_refresh_codes.size()), m_prop_refresh_codes.data())) {
+            m_prop_changes.invalidate();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+bool CameraDevice::await_property(CrInt32u code, std::function<bool(CrInt64u)> const& predicate, std::chrono::milliseconds timeout)
+{
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    for (;;) {
+        // Read before refreshing, a change reported during the refresh then ends the wait at once
+        auto const generation = m_prop_changes.generation();
+        refresh_properties();
+        auto const record = m_prop_registry.find(code);
+        if (record && predicate(record->current)) {
+            return true;
+        }
+        if (!m_prop_changes.wait_push(generation, deadline)) {
+            return false;
+        }
+    }
+}
+
+bool CameraDevice::await_property_value(CrInt32u code, CrInt64u value, std::chrono::milliseconds timeout)
+{
+    return await_property(code, [value](CrInt64u current) { return value == current; }, timeout);
+}
+
+bool CameraDevice::await_assignments(PropertyAssignment* first, PropertyAssignment* last, std::chrono::steady_clock::time_point deadline)
+{
+    for (;;) {
+        auto const generation = m_prop_changes.generation();
+        refresh_properties();
+        bool pending = false;
+        for (auto assignment = first; assignment != last; ++assignment) {
+            if (PropertyAssignmentResult::Pending != assignment->result) {
+                continue;
+            }
+            auto const record = m_prop_registry.find(assignment->code);
+            if (record && holds_value(*record, assignment->value)) {
+                assignment->result = PropertyAssignmentResult::Confirmed;
+            }
+            else {
+                pending = true;
+            }
+        }
+        if (!pending) {
+            return true;
+        }
+        if (!m_prop_changes.wait_push(generation, deadline)) {
+            for (auto assignment = first; assignment != last; ++assignment) {
+                if (PropertyAssignmentResult::Pending == assignment->result) {
+                    assignment->result = PropertyAssignmentResult::TimedOut;
+                }
+            }
+            return false;
+        }
+    }
+}
+
+bool CameraDevice::load_properties(CrInt32u num, CrInt32u* codes)
 {
     std::int32_t nprop = 0;
     SDK::CrDeviceProperty* prop_list = nullptr;
 
-    m_prop.media_slot1_quick_format_enable_status.writable = -1;
-    m_prop.media_slot2_quick_format_enable_status.writable = -1;
-
     SDK::CrError status = SDK::CrError_Generic;
     if (0 == num){
         // Get all
@@ -4384,632 +5121,33 @@ void CameraDevice::load_properties(CrInt32u num, CrInt32u* codes)
 
     if (CR_FAILED(status)) {
         tout << "Failed to get device properties.\n";
-        return;
+        return false;
+    }
+
+    if (0 == num) {
+        // Properties missing from the list stay unsupported
+        m_prop.media_slot1_quick_format_enable_status.writable = -1;
+        m_prop.media_slot2_quick_format_enable_status.writable = -1;
+        // Properties the full list no longer reports are dropped once it is in
+        m_prop_registry.mark_unreported();
     }
 
     if (prop_list && nprop > 0) {
         // Got properties list
         for (std::int32_t i = 0; i < nprop; ++i) {
-            auto prop = prop_list[i];
-            int nval = 0;
-
-            switch (prop.GetCode()) {
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_SdkControlMode:
-                m_prop.sdk_mode.writable = prop.IsSetEnableCurrentValue();
-                m_prop.sdk_mode.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
+            auto& prop = prop_list[i];
+            m_prop_registry.update(prop);
+            if (decode_property(m_prop, prop)
+                && SDK::CrDevicePropertyCode::CrDeviceProperty_SdkControlMode == prop.GetCode()) {
                 m_modeSDK = (SDK::CrSdkControlMode)m_prop.sdk_mode.current;
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FNumber:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.f_number.writable = prop.IsSetEnableCurrentValue();
-                m_prop.f_number.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_f_number(prop.GetValues(), nval);
-                    m_prop.f_number.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_IsoSensitivity:
-                nval = prop.GetValueSize() / sizeof(std::uint32_t);
-                m_prop.iso_sensitivity.writable = prop.IsSetEnableCurrentValue();
-                m_prop.iso_sensitivity.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_iso_sensitivity(prop.GetValues(), nval);
-                    m_prop.iso_sensitivity.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterSpeed:
-                nval = prop.GetValueSize() / sizeof(std::uint32_t);
-                m_prop.shutter_speed.writable = prop.IsSetEnableCurrentValue();
-                m_prop.shutter_speed.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_shutter_speed(prop.GetValues(), nval);
-                    m_prop.shutter_speed.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.position_key_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.position_key_setting.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (nval != m_prop.position_key_setting.possible.size()) {
-                    auto parsed_values = parse_position_key_setting(prop.GetValues(), nval);
-                    m_prop.position_key_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureProgramMode:
-                nval = prop.GetValueSize() / sizeof(std::uint32_t);
-                m_prop.exposure_program_mode.writable = prop.IsSetEnableCurrentValue();
-                m_prop.exposure_program_mode.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_exposure_program_mode(prop.GetValues(), nval);
-                    m_prop.exposure_program_mode.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_DriveMode:
-                nval = prop.GetValueSize() / sizeof(std::uint32_t);
-                m_prop.still_capture_mode.writable = prop.IsSetEnableCurrentValue();
-                m_prop.still_capture_mode.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_still_capture_mode(prop.GetValues(), nval);
-                    m_prop.still_capture_mode.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FocusMode:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.focus_mode.writable = prop.IsSetEnableCurrentValue();
-                m_prop.focus_mode.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_focus_mode(prop.GetValues(), nval);
-                    m_prop.focus_mode.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FocusArea:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.focus_area.writable = prop.IsSetEnableCurrentValue();
-                m_prop.focus_area.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_focus_area(prop.GetValues(), nval);
-                    m_prop.focus_area.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_LiveView_Image_Quality:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.live_view_image_quality.writable = prop.IsSetEnableCurrentValue();
-                m_prop.live_view_image_quality.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto view = parse_live_view_image_quality(prop.GetValues(), nval);
-                    m_prop.live_view_image_quality.possible.swap(view);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_FormatEnableStatus:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.media_slot1_full_format_enable_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot1_full_format_enable_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (nval != m_prop.media_slot1_full_format_enable_status.possible.size()) {
-                    auto parsed_values = parse_media_slotx_format_enable_status(prop.GetValues(), nval);
-                    m_prop.media_slot1_full_format_enable_status.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_FormatEnableStatus:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.media_slot2_full_format_enable_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot2_full_format_enable_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (nval != m_prop.media_slot2_full_format_enable_status.possible.size()) {
-                    auto parsed_values = parse_media_slotx_format_enable_status(prop.GetValues(), nval);
-                    m_prop.media_slot2_full_format_enable_status.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_QuickFormatEnableStatus:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.media_slot1_quick_format_enable_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot1_quick_format_enable_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (nval != m_prop.media_slot1_quick_format_enable_status.possible.size()) {
-                    auto parsed_values = parse_media_slotx_format_enable_status(prop.GetValues(), nval);
-                    m_prop.media_slot1_quick_format_enable_status.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_QuickFormatEnableStatus:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.media_slot2_quick_format_enable_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot2_quick_format_enable_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (nval != m_prop.media_slot2_quick_format_enable_status.possible.size()) {
-                    auto parsed_values = parse_media_slotx_format_enable_status(prop.GetValues(), nval);
-                    m_prop.media_slot2_quick_format_enable_status.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalance:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.white_balance.writable = prop.IsSetEnableCurrentValue();
-                m_prop.white_balance.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_white_balance(prop.GetValues(), nval);
-                    m_prop.white_balance.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Standby:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.customwb_capture_standby.writable = prop.IsSetEnableCurrentValue();
-                m_prop.customwb_capture_standby.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (nval != m_prop.white_balance.possible.size()) {
-                    auto parsed_values = parse_customwb_capture_standby(prop.GetValues(), nval);
-                    m_prop.customwb_capture_standby.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Standby_Cancel:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.customwb_capture_standby_cancel.writable = prop.IsSetEnableCurrentValue();
-                m_prop.customwb_capture_standby_cancel.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (nval != m_prop.customwb_capture_standby_cancel.possible.size()) {
-                    auto parsed_values = parse_customwb_capture_standby_cancel(prop.GetValues(), nval);
-                    m_prop.customwb_capture_standby_cancel.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Operation:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.customwb_capture_operation.writable = prop.IsSetEnableCurrentValue();
-                m_prop.customwb_capture_operation.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_customwb_capture_operation(prop.GetValues(), nval);
-                    m_prop.customwb_capture_operation.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Execution_State:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.customwb_capture_execution_state.writable = prop.IsSetEnableCurrentValue();
-                m_prop.customwb_capture_execution_state.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (nval != m_prop.customwb_capture_execution_state.possible.size()) {
-                    auto parsed_values = parse_customwb_capture_execution_state(prop.GetValues(), nval);
-                    m_prop.customwb_capture_execution_state.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Operation_Status:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.zoom_operation_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.zoom_operation_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (nval != m_prop.zoom_operation_status.possible.size()) {
-                    auto parsed_values = parse_zoom_operation_status(prop.GetValues(), nval);
-                    m_prop.zoom_operation_status.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Setting:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.zoom_setting_type.writable = prop.IsSetEnableCurrentValue();
-                m_prop.zoom_setting_type.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_zoom_setting_type(prop.GetValues(), nval);
-                    m_prop.zoom_setting_type.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Type_Status:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.zoom_types_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.zoom_types_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (nval != m_prop.zoom_types_status.possible.size()) {
-                    auto parsed_values = parse_zoom_types_status(prop.GetValues(), nval);
-                    m_prop.zoom_types_status.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Speed_Range:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.zoom_speed_range.writable = prop.IsSetEnableCurrentValue();
-                if (0 < nval) {
-                    auto parsed_values = parse_zoom_speed_range(prop.GetValues(), nval);
-                    m_prop.zoom_speed_range.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ZoomAndFocusPosition_Save:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.save_zoom_and_focus_position.writable = prop.IsSetEnableCurrentValue();
-                if (0 < nval) {
-                    auto parsed_values = parse_save_zoom_and_focus_position(prop.GetValues(), nval);
-                    m_prop.save_zoom_and_focus_position.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ZoomAndFocusPosition_Load:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.load_zoom_and_focus_position.writable = prop.IsSetEnableCurrentValue();
-                if (0 < nval) {
-                    auto parsed_values = parse_load_zoom_and_focus_position(prop.GetValues(), nval);
-                    m_prop.load_zoom_and_focus_position.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_Remocon_Zoom_Speed_Type:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.remocon_zoom_speed_type.writable = prop.IsSetEnableCurrentValue();
-                m_prop.remocon_zoom_speed_type.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_remocon_zoom_speed_type(prop.GetValues(), nval);
-                    m_prop.remocon_zoom_speed_type.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_APS_C_or_Full_SwitchingSetting:
-                m_prop.aps_c_of_full_switching_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.aps_c_of_full_switching_setting.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_APS_C_or_Full_SwitchingEnableStatus:
-                m_prop.aps_c_of_full_switching_enable_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.aps_c_of_full_switching_enable_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSetting_SaveOperationEnableStatus:
-                m_prop.camera_setting_save_operation.writable = prop.IsSetEnableCurrentValue();
-                m_prop.camera_setting_save_operation.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSetting_ReadOperationEnableStatus:
-                m_prop.camera_setting_read_operation.writable = prop.IsSetEnableCurrentValue();
-                m_prop.camera_setting_read_operation.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSetting_SaveRead_State:
-                m_prop.camera_setting_save_read_state.writable = prop.IsSetEnableCurrentValue();
-                m_prop.camera_setting_save_read_state.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSettingsResetEnableStatus:
-                m_prop.camera_setting_reset_enable_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.camera_setting_reset_enable_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_PlaybackMedia:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.playback_media.writable = prop.IsSetEnableCurrentValue();
-                m_prop.playback_media.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_playback_media(prop.GetValues(), nval);
-                    m_prop.playback_media.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_GainBaseSensitivity:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.gain_base_sensitivity.writable = prop.IsSetEnableCurrentValue();
-                m_prop.gain_base_sensitivity.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_gain_base_sensitivity(prop.GetValues(), nval);
-                    m_prop.gain_base_sensitivity.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_GainBaseIsoSensitivity:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.gain_base_iso_sensitivity.writable = prop.IsSetEnableCurrentValue();
-                m_prop.gain_base_iso_sensitivity.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_gain_base_iso_sensitivity(prop.GetValues(), nval);
-                    m_prop.gain_base_iso_sensitivity.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MonitorLUTSetting:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.monitor_lut_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.monitor_lut_setting.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_monitor_lut_setting(prop.GetValues(), nval);
-                    m_prop.monitor_lut_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureIndex:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.exposure_index.writable = prop.IsSetEnableCurrentValue();
-                m_prop.exposure_index.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_exposure_index(prop.GetValues(), nval);
-                    m_prop.exposure_index.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_BaseLookValue:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.baselook_value.writable = prop.IsSetEnableCurrentValue();
-                m_prop.baselook_value.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_baselook_value(prop.GetValues(), nval);
-                    m_prop.baselook_value.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_IrisModeSetting:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.iris_mode_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.iris_mode_setting.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_iris_mode_setting(prop.GetValues(), nval);
-                    m_prop.iris_mode_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterModeSetting:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.shutter_mode_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.shutter_mode_setting.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_shutter_mode_setting(prop.GetValues(), nval);
-                    m_prop.shutter_mode_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_GainControlSetting:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.gain_control_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.gain_control_setting.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_gain_control_setting(prop.GetValues(), nval);
-                    m_prop.gain_control_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureCtrlType:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.exposure_control_type.writable = prop.IsSetEnableCurrentValue();
-                m_prop.exposure_control_type.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_exposure_control_type(prop.GetValues(), nval);
-                    m_prop.exposure_control_type.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_IsoCurrentSensitivity:
-                m_prop.iso_current_sensitivity.writable = prop.IsSetEnableCurrentValue();
-                m_prop.iso_current_sensitivity.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_Movie_Recording_Setting:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.recording_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.recording_setting.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_recording_setting(prop.GetValues(), nval);
-                    m_prop.recording_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_DispModeCandidate:
-                nval = prop.GetValueSize() / sizeof(std::uint32_t);
-                m_prop.dispmode_candidate.writable = prop.IsSetEnableCurrentValue();
-                m_prop.dispmode_candidate.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_dispmode_candidate(prop.GetValues(), nval);
-                    m_prop.dispmode_candidate.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_DispModeSetting:
-                nval = prop.GetValueSize() / sizeof(std::uint32_t);
-                m_prop.dispmode_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.dispmode_setting.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_dispmode_setting(prop.GetValues(), nval);
-                    m_prop.dispmode_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_DispMode:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.dispmode.writable = prop.IsSetEnableCurrentValue();
-                m_prop.dispmode.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_dispmode(prop.GetValues(), nval);
-                    m_prop.dispmode.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_GaindBValue:
-                nval = prop.GetValueSize() / sizeof(std::int8_t);
-                m_prop.gain_db_value.writable = prop.IsSetEnableCurrentValue();
-                m_prop.gain_db_value.current = static_cast<std::int8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_gain_db_value(prop.GetValues(), nval);
-                    m_prop.gain_db_value.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalanceTint:
-                nval = prop.GetValueSize() / sizeof(std::int8_t);
-                m_prop.white_balance_tint.writable = prop.IsSetEnableCurrentValue();
-                m_prop.white_balance_tint.current = static_cast<std::int8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_white_balance_tint(prop.GetValues(), nval);
-                    m_prop.white_balance_tint.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalanceTintStep:
-                nval = prop.GetValueSize() / sizeof(std::int16_t);
-                m_prop.white_balance_tint_step.writable = prop.IsSetEnableCurrentValue();
-                m_prop.white_balance_tint_step.current = static_cast<std::int16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_white_balance_tint_step(prop.GetValues(), nval);
-                    m_prop.white_balance_tint_step.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MovieRecButtonToggleEnableStatus:
-                m_prop.movie_rec_button_toggle_enable_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.movie_rec_button_toggle_enable_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterSpeedValue:
-                nval = prop.GetValueSize() / sizeof(std::uint64_t);
-                m_prop.shutter_speed_value.writable = prop.IsSetEnableCurrentValue();
-                m_prop.shutter_speed_value.current = static_cast<std::uint64_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_shutter_speed_value(prop.GetValues(), nval);
-                    m_prop.shutter_speed_value.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_Status:
-                m_prop.media_slot1_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot1_status.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_Status:
-                m_prop.media_slot2_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot2_status.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT3_Status:
-                m_prop.media_slot3_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot3_status.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FocusBracketShotNumber:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.focus_bracket_shot_num.writable = prop.IsSetEnableCurrentValue();
-                m_prop.focus_bracket_shot_num.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_focus_bracket_shot_num(prop.GetValues(), nval);
-                    m_prop.focus_bracket_shot_num.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FocusBracketFocusRange:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.focus_bracket_focus_range.writable = prop.IsSetEnableCurrentValue();
-                m_prop.focus_bracket_focus_range.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_focus_bracket_focus_range(prop.GetValues(), nval);
-                    m_prop.focus_bracket_focus_range.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_Movie_ImageStabilizationSteadyShot:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.movie_image_stabilization_steady_shot.writable = prop.IsSetEnableCurrentValue();
-                m_prop.movie_image_stabilization_steady_shot.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_movie_image_stabilization_steady_shot(prop.GetValues(), nval);
-                    m_prop.movie_image_stabilization_steady_shot.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ImageStabilizationSteadyShot:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.image_stabilization_steady_shot.writable = prop.IsSetEnableCurrentValue();
-                m_prop.image_stabilization_steady_shot.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_image_stabilization_steady_shot(prop.GetValues(), nval);
-                    m_prop.image_stabilization_steady_shot.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_SilentMode:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.silent_mode.writable = prop.IsSetEnableCurrentValue();
-                m_prop.silent_mode.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_silent_mode(prop.GetValues(), nval);
-                    m_prop.silent_mode.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeApertureDriveInAF:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.silent_mode_aperture_drive_in_af.writable = prop.IsSetEnableCurrentValue();
-                m_prop.silent_mode_aperture_drive_in_af.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_silent_mode_aperture_drive_in_af(prop.GetValues(), nval);
-                    m_prop.silent_mode_aperture_drive_in_af.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeShutterWhenPowerOff:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.silent_mode_shutter_when_power_off.writable = prop.IsSetEnableCurrentValue();
-                m_prop.silent_mode_shutter_when_power_off.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_silent_mode_shutter_when_power_off(prop.GetValues(), nval);
-                    m_prop.silent_mode_shutter_when_power_off.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeAutoPixelMapping:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.silent_mode_auto_pixel_mapping.writable = prop.IsSetEnableCurrentValue();
-                m_prop.silent_mode_auto_pixel_mapping.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_silent_mode_auto_pixel_mapping(prop.GetValues(), nval);
-                    m_prop.silent_mode_auto_pixel_mapping.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterType:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.shutter_type.writable = prop.IsSetEnableCurrentValue();
-                m_prop.shutter_type.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_shutter_type(prop.GetValues(), nval);
-                    m_prop.shutter_type.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MovieShootingMode:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.movie_shooting_mode.writable = prop.IsSetEnableCurrentValue();
-                m_prop.movie_shooting_mode.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_movie_shooting_mode(prop.GetValues(), nval);
-                    m_prop.movie_shooting_mode.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FocusPositionSetting:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.focus_position_setting.writable = prop.IsSetEnableCurrentValue();
-                m_prop.focus_position_setting.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_focus_position(prop.GetValues(), nval);
-                    m_prop.focus_position_setting.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FocusPositionCurrentValue:
-                nval = prop.GetValueSize() / sizeof(std::uint16_t);
-                m_prop.focus_position_current_value.writable = prop.IsSetEnableCurrentValue();
-                m_prop.focus_position_current_value.current = static_cast<std::uint16_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_focus_position(prop.GetValues(), nval);
-                    m_prop.focus_position_current_value.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_FocusDrivingStatus:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.focus_driving_status.writable = prop.IsSetEnableCurrentValue();
-                m_prop.focus_driving_status.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_focus_driving_status(prop.GetValues(), nval);
-                    m_prop.focus_driving_status.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_ZoomDistance:
-                nval = prop.GetValueSize() / sizeof(std::uint32_t);
-                m_prop.zoom_distance.writable = prop.IsSetEnableCurrentValue();
-                m_prop.zoom_distance.current = static_cast<std::uint32_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_zoom_distance(prop.GetValues(), nval);
-                    m_prop.zoom_distance.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_LensModelName:
-            {
-                m_prop.lensModelNameStr.writable = prop.IsSetEnableCurrentValue();
-                CrInt16u* pCurrentStr = prop.GetCurrentStr();
-                if (pCurrentStr)
-                {
-                    m_prop.lensModelNameStr.length = (int)*pCurrentStr;
-#if defined(WIN32) || defined(_WIN64)//#if defined(_UNICODE) || defined(UNICODE)
-                    m_prop.lensModelNameStr.current = text((CrChar*)&pCurrentStr[1]);
-#else
-                    char buff[128];
-                    memset(buff, 0, sizeof(buff));
-                    pCurrentStr++;
-                    for (int i = 0; i < (m_prop.lensModelNameStr.length - 1); ++i,pCurrentStr++)
-                    {
-                        wctomb(&buff[i], (wchar_t)*pCurrentStr);
-                    }
-                    if (0 < strlen(buff))
-                    {
-                        m_prop.lensModelNameStr.current = text((CrChar*)buff);
-                    }
-#endif
-                }
-            }                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_RecordingAvailableType:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.media_slot1_recording_available_type.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot1_recording_available_type.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_slotx_rec_available(prop.GetValues(), nval);
-                    m_prop.media_slot1_recording_available_type.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_RecordingAvailableType:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.media_slot2_recording_available_type.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot2_recording_available_type.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_slotx_rec_available(prop.GetValues(), nval);
-                    m_prop.media_slot2_recording_available_type.possible.swap(parsed_values);
-                }
-                break;
-            case SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT3_RecordingAvailableType:
-                nval = prop.GetValueSize() / sizeof(std::uint8_t);
-                m_prop.media_slot3_recording_available_type.writable = prop.IsSetEnableCurrentValue();
-                m_prop.media_slot3_recording_available_type.current = static_cast<std::uint8_t>(prop.GetCurrentValue());
-                if (0 < nval) {
-                    auto parsed_values = parse_slotx_rec_available(prop.GetValues(), nval);
-                    m_prop.media_slot3_recording_available_type.possible.swap(parsed_values);
-                }
-                break;
-            default:
-                break;
             }
         }
         SDK::ReleaseDeviceProperties(m_device_handle, prop_list);
     }
+    if (0 == num) {
+        m_prop_registry.remove_unreported();
+    }
+    return true;
 }
 
 void CameraDevice::get_property(SDK::CrDeviceProperty& prop) const
@@ -5019,10 +5157,15 @@ void CameraDevice::get_property(SDK::CrDeviceProperty& prop) const
     SDK::GetDeviceProperties(m_device_handle, &properties, &nprops);
 }
 
-bool CameraDevice::set_property(SDK::CrDeviceProperty& prop) const
+SDK::CrError CameraDevice::set_property(SDK::CrDeviceProperty& prop) const
 {
-    SDK::SetDeviceProperty(m_device_handle, &prop);
-    return false;
+    // Noted first, the camera may report the change before SetDeviceProperty() returns
+    m_prop_history.wrote(prop.GetCode());
+    auto const err = SDK::SetDeviceProperty(m_device_handle, &prop);
+    if (CR_FAILED(err)) {
+        m_prop_history.write_failed(prop.GetCode());
+    }
+    return err;
 }
 
 void CameraDevice::getContentsList()
@@ -5420,6 +5563,16 @@ void CameraDevice::getThumbnail(SDK::CrContentHandle content)
             if (fileType == SDK::CrFileType_Heif) {
                 filename= (TEXT("Thumbnail.HIF"));
             }
+            else {
+                auto const status = check_jpeg(image_data->GetImageData(), image_data->GetImageSize());
+                if (JpegStatus::Valid != status) {
+                    // FAILED
+                    delete[] image_buff; // Release
+                    delete image_data; // Release
+                    tout << "getThumbnail FAILED (" << to_string(status) << ")\n";
+                    return;
+                }
+            }
 
 #if defined(__APPLE__)
             char path[MAC_MAX_PATH]; /*MAX_PATH*/
@@ -5704,7 +5857,7 @@ void CameraDevice::get_mediaprofile()
     SCRSDK::CrMediaProfile slot;
 
     bool canExec = false;
-    load_properties();
+    refresh_properties();
     switch (selected_index)
     {
     case 1:
@@ -5823,7 +5976,7 @@ void CameraDevice::get_mediaprofile()
 
 bool CameraDevice::get_focus_position_setting()
 {
-    load_properties();
+    refresh_properties();
     if (m_prop.focus_position_setting.possible.size() < 1) {
         tout << "Focus Position Setting is not supported.\n";
         return false;
@@ -5910,13 +6063,13 @@ void CameraDevice::set_focus_position_setting()
     prop.SetCode(SDK::CrDevicePropertyCode::CrDeviceProperty_FocusPositionSetting);
     prop.SetCurrentValue((CrInt64u)value);
     prop.SetValueType(SDK::CrDataType::CrDataType_UInt16);
-    SDK::SetDeviceProperty(m_device_handle, &prop);
+    set_property(prop);
 
     tout << "Setting focus position settings...";
     std::this_thread::sleep_for(500ms);
     while (1)
     {
-        load_properties();
+        refresh_properties();
         tout << "Focus Position Current Value : ";
         format_focus_position_value(m_prop.focus_position_current_value.current);
         if (m_prop.focus_driving_status.current != SDK::CrFocusDrivingStatus::CrFocusDrivingStatus_Driving)
@@ -5948,7 +6101,7 @@ bool CameraDevice::execute_focus_position_cancel()
         return false;
     }
 
-    load_properties();
+    refresh_properties();
     if (m_prop.focus_driving_status.current == SDK::CrFocusDrivingStatus::CrFocusDrivingStatus_Driving) {
         SDK::SendCommand(m_device_handle, SDK::CrCommandId::CrCommandId_CancelFocusPosition, SDK::CrCommandParam::CrCommandParam_Down);
         //std::this_thread::sleep_for(10ms);
@@ -0,0 +1,624 @@
+#include "JpegLuma.h"
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+using byte = std::uint8_t;
+
+constexpr byte const Marker = 0xFF;
+constexpr byte const SOI = 0xD8;
+constexpr byte const EOI = 0xD9;
+constexpr byte const SOS = 0xDA;
+constexpr byte const DQT = 0xDB;
+constexpr byte const DRI = 0xDD;
+constexpr byte const DHT = 0xC4;
+constexpr byte const SOF0 = 0xC0;
+constexpr byte const SOF1 = 0xC1;
+constexpr byte const SOF15 = 0xCF;
+constexpr byte const JPG = 0xC8;
+constexpr byte const DAC = 0xCC;
+constexpr byte const RST0 = 0xD0;
+constexpr byte const RST7 = 0xD7;
+constexpr byte const TEM = 0x01;
+
+// Natural (row-major) position of the k-th coefficient in zigzag order
+constexpr byte const ZigZag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// The mean of cos((2x + 1) u pi / 16) over each half of the block vanishes for even u > 0,
+// so the mean of a 4x4 quadrant only depends on the coefficients with u, v in {0, 1, 3, 5, 7}.
+constexpr int const ReducedCount = 25;
+constexpr byte const ReducedIndex[ReducedCount] = {
+     0,  1,  3,  5,  7,
+     8,  9, 11, 13, 15,
+    24, 25, 27, 29, 31,
+    40, 41, 43, 45, 47,
+    56, 57, 59, 61, 63,
+};
+
+// Quadrant means as weights of the dequantized coefficients, quadrant q = 2 * row + column
+struct QuadrantWeights
+{
+    float weight[4][ReducedCount];
+
+    QuadrantWeights()
+    {
+        double const pi = std::acos(-1.0);
+        double half[8][2]; // C(u) / 2 * mean over x in [0, 4) and [4, 8) of cos((2x + 1) u pi / 16)
+        for (int u = 0; u < 8; ++u) {
+            double const scale = (0 == u ? 1.0 / std::sqrt(2.0) : 1.0) / 2.0;
+            for (int side = 0; side < 2; ++side) {
+                double sum = 0.0;
+                for (int x = side * 4; x < side * 4 + 4; ++x) {
+                    sum += std::cos((2 * x + 1) * u * pi / 16.0);
+                }
+                half[u][side] = scale * sum / 4.0;
+            }
+        }
+        for (int q = 0; q < 4; ++q) {
+            for (int i = 0; i < ReducedCount; ++i) {
+                int const v = ReducedIndex[i] / 8;
+                int const u = ReducedIndex[i] % 8;
+                weight[q][i] = static_cast<float>(half[v][q >> 1] * half[u][q & 1]);
+            }
+        }
+    }
+};
+
+QuadrantWeights const Weights;
+
+std::uint32_t read_be16(byte const* p)
+{
+    return (static_cast<std::uint32_t>(p[0]) << 8) | p[1];
+}
+
+int extend(int value, int bits)
+{
+    return value < (1 << (bits - 1)) ? value - (1 << bits) + 1 : value;
+}
+} // namespace
+
+namespace cli
+{
+// MSB-first reader over entropy-coded data: removes FF00 stuffing and stops at the next
+// marker, feeding zero bytes past it. Reading any of them means the data was cut short.
+class JpegLumaDecoder::BitReader
+{
+public:
+    BitReader(byte const* p, byte const* end)
+        : m_p(p)
+        , m_end(end)
+        , m_bits(0)
+        , m_count(0)
+        , m_padding(0)
+        , m_marker(false)
+    {}
+
+    // Make at least n <= 57 bits available to peek() and take()
+    void ensure(int n)
+    {
+        if (m_count < n) fill();
+    }
+
+    std::uint32_t peek(int n) const
+    {
+        return static_cast<std::uint32_t>(m_bits >> (64 - n));
+    }
+
+    void skip(int n)
+    {
+        m_bits <<= n;
+        m_count -= n;
+    }
+
+    int take(int n)
+    {
+        if (0 == n) return 0;
+        int const value = static_cast<int>(peek(n));
+        skip(n);
+        return value;
+    }
+
+    // Drop the partial byte and step over the RSTn marker which must follow
+    bool restart()
+    {
+        m_bits = 0;
+        m_count = 0;
+        m_padding = 0;
+        m_marker = false;
+        if (m_end - m_p < 2 || Marker != m_p[0] || m_p[1] < RST0 || RST7 < m_p[1]) {
+            return false;
+        }
+        m_p += 2;
+        return true;
+    }
+
+    bool overrun() const { return m_count < static_cast<int>(m_padding * 8); }
+    byte const* position() const { return m_p; }
+
+private:
+    void fill()
+    {
+        // Fast path: the bytes which fit hold no 0xFF, so take them at once
+        if (!m_marker && 8 <= m_end - m_p) {
+            std::uint64_t word = 0;
+            for (int i = 0; i < 8; ++i) {
+                word = (word << 8) | m_p[i];
+            }
+            int const count = (64 - m_count) >> 3;
+            std::uint64_t const keep = (8 == count) ? ~0ull : ~(~0ull >> (count * 8));
+            std::uint64_t const inverted = ~word; // 0xFF bytes become zero
+            std::uint64_t const zero = (inverted - 0x0101010101010101ull) & word & 0x8080808080808080ull;
+            if (0 == (zero & keep)) {
+                m_bits |= (word & keep) >> m_count;
+                m_p += count;
+                m_count += count * 8;
+                return;
+            }
+        }
+        while (m_count <= 56) {
+            std::uint64_t value = 0;
+            if (!m_marker && m_p < m_end) {
+                value = *m_p;
+                if (Marker != value) {
+                    ++m_p;
+                }
+                else if (1 < m_end - m_p && 0 == m_p[1]) {
+                    m_p += 2;
+                }
+                else {
+                    m_marker = true;
+                    value = 0;
+                    ++m_padding;
+                }
+            }
+            else {
+                ++m_padding;
+            }
+            m_bits |= value << (56 - m_count);
+            m_count += 8;
+        }
+    }
+
+private:
+    byte const* m_p;
+    byte const* m_end;
+    std::uint64_t m_bits;  // left-aligned
+    int m_count;
+    unsigned m_padding;    // zero bytes fed past the marker or the end
+    bool m_marker;
+};
+
+JpegLumaDecoder::JpegLumaDecoder()
+    : m_quant()
+    , m_dc()
+    , m_ac()
+    , m_components()
+    , m_component_count(0)
+    , m_width(0)
+    , m_height(0)
+    , m_max_h(1)
+    , m_max_v(1)
+    , m_restart_interval(0)
+    , m_has_frame(false)
+    , m_error(nullptr)
+{
+}
+
+bool JpegLumaDecoder::decode(std::uint8_t const* data, std::size_t size, LumaPlane& plane)
+{
+    m_error = nullptr;
+    m_has_frame = false;
+    m_restart_interval = 0;
+    for (int i = 0; i < 4; ++i) {
+        m_dc[i].defined = false;
+        m_ac[i].defined = false;
+    }
+
+    if (!data || size < 4 || Marker != data[0] || SOI != data[1]) {
+        return fail("missing SOI");
+    }
+    byte const* p = data + 2;
+    byte const* const end = data + size;
+    for (;;) {
+        while (p < end && Marker != *p) ++p; // tolerate garbage between segments
+        while (p < end && Marker == *p) ++p;
+        if (end == p) {
+            return fail("no luma scan");
+        }
+        byte const marker = *p++;
+        if (EOI == marker) {
+            return fail("no luma scan");
+        }
+        if (TEM == marker || (RST0 <= marker && marker <= RST7)) {
+            continue;
+        }
+        if (end - p < 2) {
+            return fail("truncated segment");
+        }
+        std::size_t const length = read_be16(p);
+        if (length < 2 || static_cast<std::size_t>(end - p) < length) {
+            return fail("truncated segment");
+        }
+        byte const* const payload = p + 2;
+        std::size_t const payload_length = length - 2;
+        p += length;
+
+        switch (marker) {
+        case DQT:
+            if (!parse_quant(payload, payload_length)) return false;
+            break;
+        case DHT:
+            if (!parse_huffman(payload, payload_length)) return false;
+            break;
+        case SOF0:
+        case SOF1:
+            if (!parse_frame(payload, payload_length)) return false;
+            break;
+        case DRI:
+            if (payload_length < 2) return fail("bad DRI");
+            m_restart_interval = read_be16(payload);
+            break;
+        case SOS: {
+            if (!m_has_frame) {
+                return fail("scan before frame header");
+            }
+            bool luma = false;
+            for (int i = 0; i < payload[0] && 1 + 2 * i < static_cast<int>(payload_length); ++i) {
+                luma = luma || payload[1 + 2 * i] == m_components[0].id;
+            }
+            if (!decode_scan(payload, payload_length, p, end, plane)) {
+                return false;
+            }
+            if (luma) {
+                return true;
+            }
+            break;
+        }
+        default:
+            if (SOF0 < marker && marker <= SOF15 && JPG != marker && DAC != marker) {
+                return fail("not a baseline JPEG");
+            }
+            break; // APPn, COM and the like
+        }
+    }
+}
+
+bool JpegLumaDecoder::fail(char const* error)
+{
+    m_error = error;
+    return false;
+}
+
+bool JpegLumaDecoder::parse_quant(std::uint8_t const* p, std::size_t length)
+{
+    while (0 < length) {
+        int const precision = p[0] >> 4;
+        int const index = p[0] & 0x0F;
+        std::size_t const needed = 1 + 64 * (precision ? 2 : 1);
+        if (3 < index || 1 < precision || length < needed) {
+            return fail("bad DQT");
+        }
+        for (int k = 0; k < 64; ++k) {
+            m_quant[index][ZigZag[k]] = static_cast<std::uint16_t>(precision ? read_be16(p + 1 + 2 * k) : p[1 + k]);
+        }
+        p += needed;
+        length -= needed;
+    }
+    return true;
+}
+
+bool JpegLumaDecoder::parse_huffman(std::uint8_t const* p, std::size_t length)
+{
+    while (0 < length) {
+        if (length < 17) {
+            return fail("bad DHT");
+        }
+        int const table_class = p[0] >> 4;
+        int const index = p[0] & 0x0F;
+        if (1 < table_class || 3 < index) {
+            return fail("bad DHT");
+        }
+        std::size_t total = 0;
+        for (int i = 1; i <= 16; ++i) {
+            total += p[i];
+        }
+        if (256 < total || length < 17 + total) {
+            return fail("bad DHT");
+        }
+
+        Huffman& table = (0 == table_class) ? m_dc[index] : m_ac[index];
+        std::memset(table.fast_length, 0, sizeof(table.fast_length));
+        std::memcpy(table.values, p + 17, total);
+        std::int32_t code = 0;
+        std::int32_t k = 0;
+        for (int bits = 1; bits <= 16; ++bits) {
+            int const count = p[bits];
+            table.offset[bits] = k - code;
+            for (int i = 0; i < count; ++i, ++code, ++k) {
+                if (bits <= 9) {
+                    int const shift = 9 - bits;
+                    for (int j = 0; j < (1 << shift); ++j) {
+                        table.fast_length[(code << shift) | j] = static_cast<std::uint8_t>(bits);
+                        table.fast_value[(code << shift) | j] = table.values[k];
+                    }
+                }
+            }
+            if ((1 << bits) < code) {
+                return fail("bad DHT");
+            }
+            table.max_code[bits] = count ? code - 1 : -1;
+            code <<= 1;
+        }
+        table.max_code[17] = INT_MAX;
+        table.defined = true;
+
+        // AC symbols whose value bits also fit into the lookahead are decoded in one step
+        std::memset(table.fast_ac, 0, sizeof(table.fast_ac));
+        for (int i = 0; 1 == table_class && i < 512; ++i) {
+            int const bits = table.fast_length[i];
+            int const run = table.fast_value[i] >> 4;
+            int const size = table.fast_value[i] & 0x0F;
+            if (0 == bits || 0 == size || 9 < bits + size) {
+                continue;
+            }
+            int const value = extend(((i << bits) & 511) >> (9 - size), size);
+            if (-128 <= value && value <= 127) {
+                table.fast_ac[i] = static_cast<std::int16_t>(value * 256 + run * 16 + bits + size);
+            }
+        }
+
+        p += 17 + total;
+        length -= 17 + total;
+    }
+    return true;
+}
+
+bool JpegLumaDecoder::parse_frame(std::uint8_t const* p, std::size_t length)
+{
+    if (length < 6 || 8 != p[0]) {
+        return fail("not an 8-bit JPEG");
+    }
+    m_height = static_cast<int>(read_be16(p + 1));
+    m_width = static_cast<int>(read_be16(p + 3));
+    m_component_count = p[5];
+    if (0 == m_width || 0 == m_height) {
+        return fail("unsupported frame size");
+    }
+    if (m_component_count < 1 || 4 < m_component_count || length < 6 + 3 * static_cast<std::size_t>(m_component_count)) {
+        return fail("bad SOF");
+    }
+
+    m_max_h = 1;
+    m_max_v = 1;
+    for (int i = 0; i < m_component_count; ++i) {
+        auto& component = m_components[i];
+        byte const* c = p + 6 + 3 * i;
+        component.id = c[0];
+        component.h = c[1] >> 4;
+        component.v = c[1] & 0x0F;
+        component.quant = c[2];
+        if (component.h < 1 || 4 < component.h || component.v < 1 || 4 < component.v || 3 < component.quant) {
+            return fail("bad SOF");
+        }
+        m_max_h = component.h < m_max_h ? m_max_h : component.h;
+        m_max_v = component.v < m_max_v ? m_max_v : component.v;
+    }
+    m_has_frame = true;
+    return true;
+}
+
+bool JpegLumaDecoder::decode_scan(std::uint8_t const* p, std::size_t length, std::uint8_t const*& data, std::uint8_t const* end, LumaPlane& plane)
+{
+    int const count = p[0];
+    if (count < 1 || 4 < count || length < 4 + 2 * static_cast<std::size_t>(count)) {
+        return fail("bad SOS");
+    }
+    Component* scan[4];
+    for (int i = 0; i < count; ++i) {
+        scan[i] = nullptr;
+        for (int c = 0; c < m_component_count; ++c) {
+            if (m_components[c].id == p[1 + 2 * i]) {
+                scan[i] = &m_components[c];
+            }
+        }
+        if (!scan[i]) {
+            return fail("bad SOS");
+        }
+        scan[i]->dc_table = p[2 + 2 * i] >> 4;
+        scan[i]->ac_table = p[2 + 2 * i] & 0x0F;
+        scan[i]->dc_pred = 0;
+        if (3 < scan[i]->dc_table || 3 < scan[i]->ac_table
+            || !m_dc[scan[i]->dc_table].defined || !m_ac[scan[i]->ac_table].defined) {
+            return fail("missing Huffman table");
+        }
+    }
+    byte const* const spectral = p + 1 + 2 * count;
+    if (0 != spectral[0] || 63 != spectral[1]) {
+        return fail("not a baseline JPEG");
+    }
+
+    Component* const luma = &m_components[0];
+    int const mcu_x = (m_width + 8 * m_max_h - 1) / (8 * m_max_h);
+    int const mcu_y = (m_height + 8 * m_max_v - 1) / (8 * m_max_v);
+    int const luma_width = (m_width * luma->h + m_max_h - 1) / m_max_h;
+    int const luma_height = (m_height * luma->v + m_max_v - 1) / m_max_v;
+    plane.stride = mcu_x * luma->h * 2;
+    plane.width = (luma_width + 3) / 4;
+    plane.height = (luma_height + 3) / 4;
+    std::size_t const plane_size = static_cast<std::size_t>(plane.stride) * mcu_y * luma->v * 2;
+    if (plane.pixels.size() < plane_size) {
+        plane.pixels.resize(plane_size);
+    }
+
+    // Interleaved scans walk MCUs, a single-component scan walks that component's own blocks
+    int units_x = mcu_x;
+    int units_y = mcu_y;
+    if (1 == count) {
+        units_x = ((m_width * scan[0]->h + m_max_h - 1) / m_max_h + 7) / 8;
+        units_y = ((m_height * scan[0]->v + m_max_v - 1) / m_max_v + 7) / 8;
+    }
+
+    BitReader bits(data, end);
+    float coef[64]; // float, so its stores cannot alias the bit reader state
+    unsigned to_restart = m_restart_interval;
+    for (int uy = 0; uy < units_y; ++uy) {
+        for (int ux = 0; ux < units_x; ++ux) {
+            if (0 != m_restart_interval) {
+                if (0 == to_restart) {
+                    if (bits.overrun() || !bits.restart()) {
+                        return fail("missing restart marker");
+                    }
+                    for (int i = 0; i < count; ++i) {
+                        scan[i]->dc_pred = 0;
+                    }
+                    to_restart = m_restart_interval;
+                }
+                --to_restart;
+            }
+
+            for (int i = 0; i < count; ++i) {
+                Component& component = *scan[i];
+                bool const is_luma = &component == luma;
+                int const blocks_x = (1 == count) ? 1 : component.h;
+                int const blocks_y = (1 == count) ? 1 : component.v;
+                for (int by = 0; by < blocks_y; ++by) {
+                    for (int bx = 0; bx < blocks_x; ++bx) {
+                        if (!decode_block(bits, component, is_luma, coef)) {
+                            return false;
+                        }
+                        if (is_luma) {
+                            store_block(coef, ux * blocks_x + bx, uy * blocks_y + by, plane);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (bits.overrun()) {
+        return fail("truncated scan");
+    }
+
+    // Continue with the marker which ends the entropy-coded data
+    data = bits.position();
+    while (1 < end - data && !(Marker == data[0] && 0 != data[1] && (data[1] < RST0 || RST7 < data[1]))) {
+        ++data;
+    }
+    return true;
+}
+
+bool JpegLumaDecoder::decode_block(BitReader& bits, Component& component, bool luma, float* coef)
+{
+    Huffman const& dc = m_dc[component.dc_table];
+    Huffman const& ac = m_ac[component.ac_table];
+    std::uint16_t const* quant = m_quant[component.quant];
+
+    // One refill per symbol covers its code (16 bits at most) and the value bits after it (11 at most)
+    auto decode_symbol = [&bits](Huffman const& table) -> int {
+        bits.ensure(27);
+        std::uint32_t const look = bits.peek(16);
+        std::uint32_t const fast = look >> 7;
+        if (0 != table.fast_length[fast]) {
+            bits.skip(table.fast_length[fast]);
+            return table.fast_value[fast];
+        }
+        for (int length = 10; length <= 16; ++length) {
+            auto const code = static_cast<std::int32_t>(look >> (16 - length));
+            if (code <= table.max_code[length]) {
+                bits.skip(length);
+                return table.values[code + table.offset[length]];
+            }
+        }
+        return -1;
+    };
+
+    int const dc_bits = decode_symbol(dc);
+    if (dc_bits < 0 || 11 < dc_bits) {
+        return fail("corrupt DC code");
+    }
+    component.dc_pred += dc_bits ? extend(bits.take(dc_bits), dc_bits) : 0;
+
+    if (luma) {
+        for (auto index : ReducedIndex) {
+            coef[index] = 0.0f;
+        }
+        coef[0] = static_cast<float>(component.dc_pred * quant[0]);
+    }
+
+    for (int k = 1; k < 64; ++k) {
+        bits.ensure(27);
+        int const fast = ac.fast_ac[bits.peek(9)];
+        if (0 != fast) {
+            k += (fast >> 4) & 0x0F;
+            bits.skip(fast & 0x0F);
+            if (63 < k) {
+                return fail("corrupt AC run");
+            }
+            if (luma) {
+                int const index = ZigZag[k];
+                coef[index] = static_cast<float>((fast >> 8) * quant[index]);
+            }
+            continue;
+        }
+
+        int const symbol = decode_symbol(ac);
+        if (symbol < 0) {
+            return fail("corrupt AC code");
+        }
+        int const run = symbol >> 4;
+        int const size = symbol & 0x0F;
+        if (0 == size) {
+            if (15 != run) {
+                break; // EOB
+            }
+            k += 15;
+            continue;
+        }
+        if (10 < size) {
+            // Baseline AC values have at most 10 bits, more would read past the refill
+            return fail("corrupt AC size");
+        }
+        k += run;
+        if (63 < k) {
+            return fail("corrupt AC run");
+        }
+        int const value = bits.take(size);
+        if (luma) {
+            int const index = ZigZag[k];
+            coef[index] = static_cast<float>(extend(value, size) * quant[index]); // written for every k, only ReducedIndex is read
+        }
+    }
+    return true;
+}
+
+void JpegLumaDecoder::store_block(float const* coef, int bx, int by, LumaPlane& plane) const
+{
+    float sum[4] = { 128.0f, 128.0f, 128.0f, 128.0f };
+    for (int i = 0; i < ReducedCount; ++i) {
+        float const value = coef[ReducedIndex[i]];
+        if (0.0f == value) {
+            continue;
+        }
+        for (int q = 0; q < 4; ++q) {
+            sum[q] += value * Weights.weight[q][i];
+        }
+    }
+    for (int q = 0; q < 4; ++q) {
+        float const value = sum[q] < 0.0f ? 0.0f : (255.0f < sum[q] ? 255.0f : sum[q]);
+        std::size_t const y = static_cast<std::size_t>(by) * 2 + (q >> 1);
+        std::size_t const x = static_cast<std::size_t>(bx) * 2 + (q & 1);
+        plane.pixels[y * plane.stride + x] = static_cast<std::uint8_t>(value + 0.5f);
+    }
+}
+
+} // namespace cli
@@ -0,0 +1,197 @@
+#include "JpegValidator.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && 2 <= _M_IX86_FP)
+#define JPEG_SCAN_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define JPEG_SCAN_AVX2
+#define JPEG_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER)
+#define JPEG_SCAN_AVX2
+#define JPEG_TARGET_AVX2
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#endif
+
+namespace
+{
+using byte = std::uint8_t;
+
+constexpr byte const Marker = 0xFF;
+constexpr byte const SOI = 0xD8;
+constexpr byte const EOI = 0xD9;
+constexpr byte const SOS = 0xDA;
+constexpr byte const RST0 = 0xD0;
+constexpr byte const RST7 = 0xD7;
+constexpr byte const TEM = 0x01;
+
+// Position of the first 0xFF in [p, end), end if there is none
+using find_marker_fn = byte const* (*)(byte const* p, byte const* end);
+
+byte const* find_marker_scalar(byte const* p, byte const* end)
+{
+    auto const* found = static_cast<byte const*>(std::memchr(p, Marker, end - p));
+    return found ? found : end;
+}
+
+#if defined(JPEG_SCAN_SSE2) || defined(JPEG_SCAN_AVX2)
+unsigned first_bit(std::uint32_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+#if defined(JPEG_SCAN_SSE2)
+byte const* find_marker_sse2(byte const* p, byte const* end)
+{
+    __m128i const ff = _mm_set1_epi8(static_cast<char>(Marker));
+    for (; p + 16 <= end; p += 16) {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+        auto const mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, ff)));
+        if (0 != mask) {
+            return p + first_bit(mask);
+        }
+    }
+    return find_marker_scalar(p, end);
+}
+#endif
+
+#if defined(JPEG_SCAN_AVX2)
+JPEG_TARGET_AVX2 byte const* find_marker_avx2(byte const* p, byte const* end)
+{
+    __m256i const ff = _mm256_set1_epi8(static_cast<char>(Marker));
+    for (; p + 32 <= end; p += 32) {
+        __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+        auto const mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, ff)));
+        if (0 != mask) {
+            return p + first_bit(mask);
+        }
+    }
+    return find_marker_sse2(p, end);
+}
+
+bool has_avx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    bool const osxsave_avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28));
+    if (!osxsave_avx || 6 != (_xgetbv(0) & 6)) {
+        return false; // the OS does not save the YMM registers
+    }
+    __cpuidex(info, 7, 0);
+    return 0 != (info[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+find_marker_fn select_find_marker()
+{
+#if defined(JPEG_SCAN_AVX2)
+    if (has_avx2()) {
+        return find_marker_avx2;
+    }
+#endif
+#if defined(JPEG_SCAN_SSE2)
+    return find_marker_sse2;
+#else
+    return find_marker_scalar;
+#endif
+}
+
+find_marker_fn const find_marker = select_find_marker();
+
+std::uint32_t read_be16(byte const* p)
+{
+    return (static_cast<std::uint32_t>(p[0]) << 8) | p[1];
+}
+} // namespace
+
+namespace cli
+{
+JpegStatus check_jpeg(std::uint8_t const* data, std::size_t size)
+{
+    if (!data || size < 4) {
+        return JpegStatus::TooShort;
+    }
+    if (Marker != data[0] || SOI != data[1]) {
+        return JpegStatus::MissingSoi;
+    }
+
+    byte const* p = data + 2;
+    byte const* const end = data + size;
+    bool scanned = false;
+    for (;;) {
+        // Marker segments: FF xx [length payload]
+        if (end - p < 2 || Marker != p[0]) {
+            return JpegStatus::BadSegment;
+        }
+        while (p < end && Marker == *p) ++p; // fill bytes
+        if (end == p) {
+            return JpegStatus::BadSegment;
+        }
+        byte const marker = *p++;
+        if (EOI == marker) {
+            return scanned ? JpegStatus::Valid : JpegStatus::MissingSos;
+        }
+        if (TEM == marker || (RST0 <= marker && marker <= RST7)) {
+            continue; // no length
+        }
+        if (end - p < 2) {
+            return JpegStatus::BadSegment;
+        }
+        std::uint32_t const length = read_be16(p);
+        if (length < 2 || static_cast<std::size_t>(end - p) < length) {
+            return JpegStatus::BadSegment;
+        }
+        p += length;
+        if (SOS != marker) {
+            continue;
+        }
+
+        // Entropy-coded data: runs until a marker other than stuffing (FF 00) or RSTn
+        scanned = true;
+        for (;;) {
+            p = find_marker(p, end);
+            if (end - p < 2) {
+                return JpegStatus::MissingEoi;
+            }
+            byte const next = p[1];
+            if (0x00 == next || (RST0 <= next && next <= RST7)) {
+                p += 2;
+            }
+            else if (Marker == next) {
+                ++p;
+            }
+            else {
+                break; // EOI, or the next table/scan of a progressive JPEG
+            }
+        }
+    }
+}
+
+char const* to_string(JpegStatus status)
+{
+    switch (status) {
+    case JpegStatus::Valid:      return "valid";
+    case JpegStatus::TooShort:   return "too short";
+    case JpegStatus::MissingSoi: return "missing SOI";
+    case JpegStatus::BadSegment: return "bad marker segment";
+    case JpegStatus::MissingSos: return "missing SOS";
+    case JpegStatus::MissingEoi: return "missing EOI";
+    default:                     return "unknown";
+    }
+}
+
+} // namespace cli
@@ -0,0 +1,121 @@
+#include "LatencyHistogram.h"
+#include <cmath>
+#include <limits>
+
+namespace
+{
+unsigned bit_width(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 0 == value ? 0 : 64 - __builtin_clzll(value);
+#else
+    unsigned width = 0;
+    for (; 0 != value; value >>= 1) ++width;
+    return width;
+#endif
+}
+} // namespace
+
+namespace cli
+{
+LatencyHistogram::LatencyHistogram()
+    : m_buckets()
+    , m_count(0)
+    , m_sum(0)
+    , m_min(std::numeric_limits<std::uint64_t>::max())
+    , m_max(0)
+{
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(std::uint64_t value)
+{
+    m_buckets[index_of(value)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto current = m_min.load(std::memory_order_relaxed);
+    while (value < current && !m_min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    current = m_max.load(std::memory_order_relaxed);
+    while (current < value && !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::min() const
+{
+    return 0 == count() ? 0 : m_min.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::mean() const
+{
+    auto const n = count();
+    return 0 == n ? 0.0 : static_cast<double>(m_sum.load(std::memory_order_relaxed)) / n;
+}
+
+std::uint64_t LatencyHistogram::percentile(double percent) const
+{
+    // Rank against the buckets themselves, m_count may be ahead of them while recording
+    std::uint64_t total = 0;
+    for (auto const& bucket : m_buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (0 == total) {
+        return 0;
+    }
+
+    auto rank = static_cast<std::uint64_t>(std::ceil(percent / 100.0 * total));
+    if (rank < 1) rank = 1;
+    if (total < rank) rank = total;
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BucketCount; ++i) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (rank <= seen) {
+            auto const top = max();
+            if (BucketCount - 1 == i) {
+                return top; // clamped samples
+            }
+            auto const highest = highest_of(i);
+            return top < highest ? top : highest;
+        }
+    }
+    return max();
+}
+
+std::size_t LatencyHistogram::index_of(std::uint64_t value)
+{
+    constexpr std::uint64_t const Largest = (1ull << MaxValueBits) - 1;
+    if (Largest < value) {
+        value = Largest;
+    }
+    if (value < SubBucketCount) {
+        return static_cast<std::size_t>(value);
+    }
+    // value >> shift falls in [SubBucketHalf, SubBucketCount)
+    unsigned const shift = bit_width(value) - SubBucketBits;
+    return static_cast<std::size_t>(shift * SubBucketHalf + (value >> shift));
+}
+
+std::uint64_t LatencyHistogram::highest_of(std::size_t index)
+{
+    if (index < SubBucketCount) {
+        return index;
+    }
+    unsigned const shift = static_cast<unsigned>(index / SubBucketHalf) - 1;
+    std::uint64_t const lowest = (index % SubBucketHalf + SubBucketHalf) << shift;
+    return lowest + (1ull << shift) - 1;
+}
+
+} // namespace cli
@@ -0,0 +1,239 @@
+#include "LiveViewContainer.h"
+#include <algorithm>
+#include <cstring>
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace cli
+{
+LiveViewContainerReader::LiveViewContainerReader()
+    : m_base(nullptr)
+    , m_length(0)
+#if defined(_WIN32) || defined(_WIN64)
+    , m_file(INVALID_HANDLE_VALUE)
+    , m_mapping(nullptr)
+#endif
+    , m_indexed(false)
+    , m_count(0)
+    , m_entries(nullptr)
+    , m_rebuilt()
+    , m_time_code_order()
+{
+}
+
+LiveViewContainerReader::~LiveViewContainerReader()
+{
+    close();
+}
+
+bool LiveViewContainerReader::open(text const& path)
+{
+    close();
+
+#if defined(_WIN32) || defined(_WIN64)
+#if defined(UNICODE) || defined(_UNICODE)
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+#else
+    HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+#endif
+    if (INVALID_HANDLE_VALUE == file) {
+        return false;
+    }
+    LARGE_INTEGER length;
+    if (!::GetFileSizeEx(file, &length) || length.QuadPart < static_cast<LONGLONG>(sizeof(lvc::FileHeader))) {
+        ::CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = ::CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* base = mapping ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!base) {
+        if (mapping) ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    m_mapping = mapping;
+    m_length = static_cast<std::size_t>(length.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (0 != ::fstat(fd, &st) || st.st_size < static_cast<off_t>(sizeof(lvc::FileHeader))) {
+        ::close(fd);
+        return false;
+    }
+    void* base = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd); // the mapping keeps the file referenced
+    if (MAP_FAILED == base) {
+        return false;
+    }
+    m_length = static_cast<std::size_t>(st.st_size);
+#endif
+    m_base = static_cast<CrInt8u const*>(base);
+
+    lvc::FileHeader header;
+    std::memcpy(&header, m_base, sizeof(header));
+    if (lvc::FileMagic != header.magic || lvc::Version < header.version
+        || header.header_size < sizeof(header) || m_length < header.header_size) {
+        close();
+        return false;
+    }
+
+    m_indexed = load_index();
+    if (!m_indexed) {
+        rebuild_index();
+    }
+
+    // Time codes restart when the camera resets them, fall back to a sorted order then
+    bool monotonic = true;
+    for (std::size_t i = 1; i < m_count && monotonic; ++i) {
+        monotonic = m_entries[i - 1].time_code <= m_entries[i].time_code;
+    }
+    if (!monotonic) {
+        m_time_code_order.resize(m_count);
+        for (std::size_t i = 0; i < m_count; ++i) m_time_code_order[i] = static_cast<std::uint32_t>(i);
+        std::stable_sort(m_time_code_order.begin(), m_time_code_order.end(),
+            [this](std::uint32_t a, std::uint32_t b) { return m_entries[a].time_code < m_entries[b].time_code; });
+    }
+    return true;
+}
+
+void LiveViewContainerReader::close()
+{
+    if (m_base) {
+#if defined(_WIN32) || defined(_WIN64)
+        ::UnmapViewOfFile(m_base);
+        ::CloseHandle(m_mapping);
+        ::CloseHandle(m_file);
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+#else
+        ::munmap(const_cast<CrInt8u*>(m_base), m_length);
+#endif
+    }
+    m_base = nullptr;
+    m_length = 0;
+    m_indexed = false;
+    m_count = 0;
+    m_entries = nullptr;
+    m_rebuilt.clear();
+    m_time_code_order.clear();
+}
+
+std::chrono::system_clock::time_point LiveViewContainerReader::start_time() const
+{
+    lvc::FileHeader header;
+    std::memcpy(&header, m_base, sizeof(header));
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.system_start_ns)));
+}
+
+LiveViewRecord LiveViewContainerReader::record(std::size_t index) const
+{
+    auto const& entry = m_entries[index];
+    lvc::RecordHeader header;
+    std::memcpy(&header, m_base + entry.offset, sizeof(header));
+
+    LiveViewRecord record;
+    record.frame_no = entry.frame_no;
+    record.time_code = entry.time_code;
+    record.host_time = std::chrono::nanoseconds(entry.host_time_ns);
+    record.data = m_base + entry.offset + sizeof(header);
+    record.size = header.size;
+    return record;
+}
+
+std::size_t LiveViewContainerReader::seek_time_code(CrInt32u time_code) const
+{
+    if (m_time_code_order.empty()) {
+        auto it = std::lower_bound(m_entries, m_entries + m_count, time_code,
+            [](lvc::IndexEntry const& entry, CrInt32u value) { return entry.time_code < value; });
+        return static_cast<std::size_t>(it - m_entries);
+    }
+    auto it = std::lower_bound(m_time_code_order.begin(), m_time_code_order.end(), time_code,
+        [this](std::uint32_t index, CrInt32u value) { return m_entries[index].time_code < value; });
+    return m_time_code_order.end() == it ? m_count : *it;
+}
+
+std::size_t LiveViewContainerReader::seek_host_time(std::chrono::nanoseconds host_time) const
+{
+    // Host time comes from the steady clock and never goes backwards
+    auto it = std::lower_bound(m_entries, m_entries + m_count, host_time.count(),
+        [](lvc::IndexEntry const& entry, std::int64_t value) { return entry.host_time_ns < value; });
+    return static_cast<std::size_t>(it - m_entries);
+}
+
+bool LiveViewContainerReader::load_index()
+{
+    if (m_length < sizeof(lvc::FileHeader) + sizeof(lvc::Footer)) {
+        return false;
+    }
+    lvc::Footer footer;
+    std::memcpy(&footer, m_base + m_length - sizeof(footer), sizeof(footer));
+    if (lvc::IndexMagic != footer.magic || lvc::Version < footer.version) {
+        return false;
+    }
+    std::uint64_t const index_end = m_length - sizeof(footer);
+    if (footer.index_offset < sizeof(lvc::FileHeader) || footer.index_offset > index_end
+        || 0 != footer.index_offset % lvc::Alignment
+        || 0 != (index_end - footer.index_offset) % sizeof(lvc::IndexEntry)
+        || (index_end - footer.index_offset) / sizeof(lvc::IndexEntry) != footer.count) {
+        return false;
+    }
+
+    // Records are padded, so the index in the mapping is suitably aligned to be used in place
+    auto const* entries = reinterpret_cast<lvc::IndexEntry const*>(m_base + footer.index_offset);
+    for (std::uint64_t i = 0; i < footer.count; ++i) {
+        // Every record has to lie before the index, record() trusts the entry and its header
+        std::uint64_t const offset = entries[i].offset;
+        if (footer.index_offset - sizeof(lvc::RecordHeader) < offset) {
+            return false;
+        }
+        lvc::RecordHeader header;
+        std::memcpy(&header, m_base + offset, sizeof(header));
+        if (lvc::RecordMagic != header.magic
+            || footer.index_offset - offset - sizeof(lvc::RecordHeader) < header.size) {
+            return false;
+        }
+    }
+    m_entries = entries;
+    m_count = static_cast<std::size_t>(footer.count);
+    return true;
+}
+
+void LiveViewContainerReader::rebuild_index()
+{
+    lvc::FileHeader header;
+    std::memcpy(&header, m_base, sizeof(header));
+
+    m_rebuilt.clear();
+    std::uint64_t offset = header.header_size;
+    while (offset + sizeof(lvc::RecordHeader) <= m_length) {
+        lvc::RecordHeader record;
+        std::memcpy(&record, m_base + offset, sizeof(record));
+        std::uint64_t const end = offset + sizeof(record) + record.size;
+        if (lvc::RecordMagic != record.magic || m_length < end) {
+            break; // torn write at the end of an interrupted recording
+        }
+        lvc::IndexEntry entry;
+        entry.offset = offset;
+        entry.frame_no = record.frame_no;
+        entry.time_code = record.time_code;
+        entry.host_time_ns = record.host_time_ns;
+        m_rebuilt.push_back(entry);
+        offset = end + lvc::padding(record.size);
+    }
+    m_entries = m_rebuilt.data();
+    m_count = m_rebuilt.size();
+}
+
+} // namespace cli
@@ -0,0 +1,257 @@
+#include "LiveViewFocus.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && 2 <= _M_IX86_FP)
+#define FOCUS_KERNEL_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FOCUS_KERNEL_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Laplacian sum and sum of squares of one row, x in [begin, end) with every neighbour readable
+void laplacian_row_scalar(std::uint8_t const* up, std::uint8_t const* mid, std::uint8_t const* down,
+    int begin, int end, std::int64_t& sum, std::int64_t& sum_sq)
+{
+    for (int x = begin; x < end; ++x) {
+        int const lap = 4 * mid[x] - mid[x - 1] - mid[x + 1] - up[x] - down[x];
+        sum += lap;
+        sum_sq += lap * lap;
+    }
+}
+
+// Vector body of a row, returns where the scalar tail starts.
+// Per row the 32-bit lanes hold at most width / 8 * 2 * 1020^2, far from overflow for any live-view width.
+int laplacian_row_simd(std::uint8_t const* up, std::uint8_t const* mid, std::uint8_t const* down,
+    int begin, int end, std::int64_t& sum, std::int64_t& sum_sq)
+{
+    int x = begin;
+#if defined(FOCUS_KERNEL_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const ones = _mm_set1_epi16(1);
+    __m128i sum32 = _mm_setzero_si128();
+    __m128i sq32 = _mm_setzero_si128();
+    for (; x + 8 <= end; x += 8) {
+        auto load = [zero](std::uint8_t const* p) {
+            return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p)), zero);
+        };
+        __m128i const center = load(mid + x);
+        __m128i const around = _mm_add_epi16(_mm_add_epi16(load(mid + x - 1), load(mid + x + 1)),
+            _mm_add_epi16(load(up + x), load(down + x)));
+        __m128i const lap = _mm_sub_epi16(_mm_slli_epi16(center, 2), around);
+        sum32 = _mm_add_epi32(sum32, _mm_madd_epi16(lap, ones));
+        sq32 = _mm_add_epi32(sq32, _mm_madd_epi16(lap, lap));
+    }
+    alignas(16) std::int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), sum32);
+    sum += static_cast<std::int64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), sq32);
+    sum_sq += static_cast<std::int64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+#elif defined(FOCUS_KERNEL_NEON)
+    int32x4_t sum32 = vdupq_n_s32(0);
+    int32x4_t sq32 = vdupq_n_s32(0);
+    for (; x + 8 <= end; x += 8) {
+        auto load = [](std::uint8_t const* p) {
+            return vreinterpretq_s16_u16(vmovl_u8(vld1_u8(p)));
+        };
+        int16x8_t const around = vaddq_s16(vaddq_s16(load(mid + x - 1), load(mid + x + 1)),
+            vaddq_s16(load(up + x), load(down + x)));
+        int16x8_t const lap = vsubq_s16(vshlq_n_s16(load(mid + x), 2), around);
+        sum32 = vpadalq_s16(sum32, lap);
+        sq32 = vmlal_s16(sq32, vget_low_s16(lap), vget_low_s16(lap));
+        sq32 = vmlal_s16(sq32, vget_high_s16(lap), vget_high_s16(lap));
+    }
+    sum += static_cast<std::int64_t>(vgetq_lane_s32(sum32, 0)) + vgetq_lane_s32(sum32, 1)
+        + vgetq_lane_s32(sum32, 2) + vgetq_lane_s32(sum32, 3);
+    sum_sq += static_cast<std::int64_t>(vgetq_lane_s32(sq32, 0)) + vgetq_lane_s32(sq32, 1)
+        + vgetq_lane_s32(sq32, 2) + vgetq_lane_s32(sq32, 3);
+#else
+    (void)up; (void)mid; (void)down; (void)end; (void)sum; (void)sum_sq;
+#endif
+    return x;
+}
+} // namespace
+
+namespace cli
+{
+double laplacian_variance(LumaPlane const& plane, FocusRoi const& roi)
+{
+    int const x0 = std::max(roi.x, 0) + 1;
+    int const y0 = std::max(roi.y, 0) + 1;
+    int const x1 = std::min(roi.x + roi.width, plane.width) - 1;
+    int const y1 = std::min(roi.y + roi.height, plane.height) - 1;
+    if (x1 <= x0 || y1 <= y0) {
+        return 0.0;
+    }
+
+    std::int64_t sum = 0;
+    std::int64_t sum_sq = 0;
+    for (int y = y0; y < y1; ++y) {
+        std::uint8_t const* up = plane.row(y - 1);
+        std::uint8_t const* mid = plane.row(y);
+        std::uint8_t const* down = plane.row(y + 1);
+        int const tail = laplacian_row_simd(up, mid, down, x0, x1, sum, sum_sq);
+        laplacian_row_scalar(up, mid, down, tail, x1, sum, sum_sq);
+    }
+
+    double const n = static_cast<double>(x1 - x0) * (y1 - y0);
+    double const mean = sum / n;
+    return sum_sq / n - mean * mean;
+}
+
+FocusRoi focus_roi(LiveViewOverlay const& overlay, LumaPlane const& plane)
+{
+    FocusRoi whole = { 0, 0, plane.width, plane.height };
+    if (0 == overlay.focus_count) {
+        return whole;
+    }
+
+    float left = 1.0f, top = 1.0f, right = 0.0f, bottom = 0.0f;
+    for (std::size_t i = 0; i < overlay.focus_count; ++i) {
+        auto const& rect = overlay.focus[i];
+        left = std::min(left, rect.x - rect.width / 2);
+        top = std::min(top, rect.y - rect.height / 2);
+        right = std::max(right, rect.x + rect.width / 2);
+        bottom = std::max(bottom, rect.y + rect.height / 2);
+    }
+
+    // At least 8x8 pixels, so a tiny spot still has an interior
+    constexpr int const MinSize = 8;
+    int x0 = static_cast<int>(left * plane.width);
+    int y0 = static_cast<int>(top * plane.height);
+    int x1 = static_cast<int>(right * plane.width + 0.5f);
+    int y1 = static_cast<int>(bottom * plane.height + 0.5f);
+    if (x1 - x0 < MinSize) {
+        int const center = (x0 + x1) / 2;
+        x0 = center - MinSize / 2;
+        x1 = x0 + MinSize;
+    }
+    if (y1 - y0 < MinSize) {
+        int const center = (y0 + y1) / 2;
+        y0 = center - MinSize / 2;
+        y1 = y0 + MinSize;
+    }
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, plane.width);
+    y1 = std::min(y1, plane.height);
+    if (x1 <= x0 || y1 <= y0) {
+        return whole;
+    }
+    return FocusRoi{ x0, y0, x1 - x0, y1 - y0 };
+}
+
+LiveViewFocusMeter::LiveViewFocusMeter()
+    : m_stream(nullptr)
+    , m_overlay(nullptr)
+    , m_ring()
+    , m_thread()
+    , m_running(false)
+    , m_decoder()
+    , m_plane()
+    , m_latest()
+    , m_latest_mtx()
+    , m_latest_cv()
+    , m_scored(0)
+    , m_decode_failed(0)
+    , m_dropped_before(0)
+    , m_score_age()
+{
+}
+
+LiveViewFocusMeter::~LiveViewFocusMeter()
+{
+    stop();
+}
+
+bool LiveViewFocusMeter::start(LiveViewStream& stream, LiveViewOverlayBuffer const& overlay)
+{
+    if (is_running()) {
+        return false;
+    }
+    m_stream = &stream;
+    m_overlay = &overlay;
+    m_ring = stream.subscribe(2); // only the newest frame matters
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&LiveViewFocusMeter::run, this);
+    return true;
+}
+
+void LiveViewFocusMeter::stop()
+{
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    if (m_ring) {
+        m_stream->unsubscribe(m_ring);
+        m_dropped_before += m_ring->dropped();
+        m_ring.reset();
+    }
+}
+
+LiveViewFocusResult LiveViewFocusMeter::latest() const
+{
+    std::lock_guard<std::mutex> lock(m_latest_mtx);
+    return m_latest;
+}
+
+bool LiveViewFocusMeter::wait_newer(std::uint64_t sequence, std::chrono::milliseconds timeout, LiveViewFocusResult& result) const
+{
+    std::unique_lock<std::mutex> lock(m_latest_mtx);
+    bool const newer = m_latest_cv.wait_for(lock, timeout, [this, sequence] { return sequence < m_latest.sequence; });
+    result = m_latest;
+    return newer;
+}
+
+std::uint64_t LiveViewFocusMeter::dropped() const
+{
+    return m_dropped_before + (m_ring ? m_ring->dropped() : 0);
+}
+
+void LiveViewFocusMeter::run()
+{
+    LiveViewOverlay overlay;
+    while (m_running.load(std::memory_order_acquire)) {
+        LiveViewFrame* frame = m_ring->pop_wait(50ms);
+        if (!frame) {
+            continue;
+        }
+
+        auto const started = std::chrono::steady_clock::now();
+        if (!m_decoder.decode(frame->data, frame->size, m_plane)) {
+            m_decode_failed.fetch_add(1, std::memory_order_relaxed);
+            LiveViewFramePool::release(frame);
+            continue;
+        }
+        auto const decoded = std::chrono::steady_clock::now();
+
+        m_overlay->read(overlay);
+        LiveViewFocusResult result;
+        result.roi = focus_roi(overlay, m_plane);
+        result.focus_frames = 0 < overlay.focus_count;
+        result.score = laplacian_variance(m_plane, result.roi);
+        auto const scored = std::chrono::steady_clock::now();
+
+        result.frame_no = frame->frame_no;
+        result.time_code = frame->time_code;
+        result.decode_us = std::chrono::duration_cast<std::chrono::microseconds>(decoded - started).count();
+        result.kernel_us = std::chrono::duration_cast<std::chrono::microseconds>(scored - decoded).count();
+        m_score_age.record(std::chrono::duration_cast<std::chrono::microseconds>(scored - frame->timestamp).count());
+        LiveViewFramePool::release(frame);
+
+        {
+            std::lock_guard<std::mutex> lock(m_latest_mtx);
+            result.sequence = m_latest.sequence + 1;
+            m_latest = result;
+        }
+        m_latest_cv.notify_all();
+        m_scored.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace cli
@@ -0,0 +1,88 @@
+#include "LiveViewFramePool.h"
+
+namespace cli
+{
+LiveViewFramePool::LiveViewFramePool(std::size_t count)
+    : m_frames(MaxFrameCount)
+    , m_count(0)
+    , m_grow_mtx()
+    , m_buffer_size(0)
+    , m_grow_count(0)
+    , m_next(0)
+{
+    grow_to(count < 1 ? 1 : count);
+}
+
+std::size_t LiveViewFramePool::grow_to(std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(m_grow_mtx);
+    std::size_t current = m_count.load(std::memory_order_relaxed);
+    if (MaxFrameCount < count) count = MaxFrameCount;
+    for (; current < count; ++current) {
+        m_frames[current].reset(new LiveViewFrame());
+    }
+    m_count.store(current, std::memory_order_release);
+    return current;
+}
+
+void LiveViewFramePool::reserve(CrInt32u buffer_size)
+{
+    CrInt32u current = m_buffer_size.load(std::memory_order_relaxed);
+    while (current < buffer_size
+        && !m_buffer_size.compare_exchange_weak(current, buffer_size, std::memory_order_relaxed)) {
+        // retry with the updated value
+    }
+}
+
+LiveViewFrame* LiveViewFramePool::acquire()
+{
+    std::size_t const count = m_count.load(std::memory_order_acquire);
+    for (std::size_t n = 0; n < count; ++n) {
+        LiveViewFrame& frame = *m_frames[m_next];
+        m_next = (m_next + 1) % count;
+
+        int expected = 0;
+        if (frame.refs.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+            CrInt32u const required = buffer_size();
+            if (frame.capacity < required) {
+                grow(frame, required);
+            }
+            return &frame;
+        }
+    }
+    return nullptr;
+}
+
+void LiveViewFramePool::add_ref(LiveViewFrame* frame)
+{
+    frame->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void LiveViewFramePool::release(LiveViewFrame* frame)
+{
+    frame->refs.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+std::size_t LiveViewFramePool::in_use() const
+{
+    std::size_t const count = m_count.load(std::memory_order_acquire);
+    std::size_t used = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (0 < m_frames[i]->refs.load(std::memory_order_relaxed)) ++used;
+    }
+    return used;
+}
+
+void LiveViewFramePool::grow(LiveViewFrame& frame, CrInt32u buffer_size)
+{
+    // Only called while the frame is exclusively held by the acquirer
+    frame.buffer.reset(new CrInt8u[buffer_size]);
+    frame.capacity = buffer_size;
+    frame.block.SetSize(buffer_size);
+    frame.block.SetData(frame.buffer.get());
+    frame.data = nullptr;
+    frame.size = 0;
+    m_grow_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace cli
@@ -0,0 +1,84 @@
+#include "LiveViewFrameRing.h"
+#include <utility>
+
+namespace cli
+{
+LiveViewFrameRing::LiveViewFrameRing(std::size_t capacity, std::shared_ptr<LiveViewFrameSignal> signal)
+    : m_slots()
+    , m_mask(0)
+    , m_head(0)
+    , m_tail(0)
+    , m_dropped(0)
+    , m_signal(signal ? std::move(signal) : std::make_shared<LiveViewFrameSignal>())
+{
+    std::size_t size = 1;
+    while (size < capacity) size <<= 1;
+    m_slots.reset(new std::atomic<LiveViewFrame*>[size]);
+    for (std::size_t i = 0; i < size; ++i) {
+        m_slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+    m_mask = size - 1;
+}
+
+LiveViewFrameRing::~LiveViewFrameRing()
+{
+    clear();
+}
+
+void LiveViewFrameRing::push(LiveViewFrame* frame)
+{
+    std::uint64_t const head = m_head.load(std::memory_order_relaxed);
+    std::uint64_t tail = m_tail.load(std::memory_order_acquire);
+    while (capacity() <= head - tail) {
+        // Full: drop the oldest. Only the producer writes slots, so the value is stable
+        // until the CAS below decides whether the consumer or we own it.
+        LiveViewFrame* oldest = m_slots[tail & m_mask].load(std::memory_order_relaxed);
+        if (m_tail.compare_exchange_strong(tail, tail + 1, std::memory_order_acq_rel)) {
+            LiveViewFramePool::release(oldest);
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        // The consumer took it first, tail has been reloaded
+    }
+
+    m_slots[head & m_mask].store(frame, std::memory_order_relaxed);
+    m_head.store(head + 1, std::memory_order_release);
+    m_signal->notify();
+}
+
+LiveViewFrame* LiveViewFrameRing::pop()
+{
+    std::uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    for (;;) {
+        std::uint64_t const head = m_head.load(std::memory_order_acquire);
+        if (tail == head) {
+            return nullptr;
+        }
+        LiveViewFrame* frame = m_slots[tail & m_mask].load(std::memory_order_relaxed);
+        if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_acq_rel)) {
+            return frame;
+        }
+        // The producer dropped this frame, retry with the reloaded tail
+    }
+}
+
+LiveViewFrame* LiveViewFrameRing::pop_wait(std::chrono::milliseconds timeout)
+{
+    return m_signal->wait(timeout, [this] { return pop(); });
+}
+
+void LiveViewFrameRing::clear()
+{
+    while (LiveViewFrame* frame = pop()) {
+        LiveViewFramePool::release(frame);
+    }
+}
+
+std::size_t LiveViewFrameRing::size() const
+{
+    std::uint64_t const tail = m_tail.load(std::memory_order_acquire);
+    std::uint64_t const head = m_head.load(std::memory_order_acquire);
+    return (head < tail) ? 0 : static_cast<std::size_t>(head - tail);
+}
+
+} // namespace cli
@@ -0,0 +1,115 @@
+#include "LiveViewGovernor.h"
+#include <algorithm>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr double const Decrease = 0.75;
+// From MinFps back to the ceiling
+constexpr double const RampSeconds = 1.0;
+constexpr double const BacklogFill = 0.75;
+constexpr double const DrainedFill = 0.25;
+// Fetch latency above CongestedFactor times its floor, and at least CongestedMarginUs over it
+constexpr double const CongestedFactor = 2.0;
+constexpr double const CongestedMarginUs = 2000.0;
+constexpr std::chrono::microseconds const MinHold = 100ms;
+} // namespace
+
+namespace cli
+{
+LiveViewGovernor::LiveViewGovernor()
+    : m_has_frame(false)
+    , m_last_frame()
+    , m_hold_until()
+    , m_rate(0.0)
+    , m_camera_fps(0.0)
+    , m_limiting(false)
+    , m_latency_floor(0.0)
+    , m_latency_average(0.0)
+    , m_target_fps(0.0)
+    , m_rate_fps(0.0)
+    , m_throttling(false)
+    , m_backlog_decreases(0)
+    , m_bandwidth_decreases(0)
+{
+}
+
+void LiveViewGovernor::reset()
+{
+    m_has_frame = false;
+    m_hold_until = clock::time_point();
+    m_rate = 0.0;
+    m_camera_fps = 0.0;
+    m_limiting = false;
+    m_latency_floor = 0.0;
+    m_latency_average = 0.0;
+    m_rate_fps.store(0.0, std::memory_order_relaxed);
+    m_throttling.store(false, std::memory_order_relaxed);
+}
+
+void LiveViewGovernor::set_target_fps(double fps)
+{
+    m_target_fps.store(std::max(0.0, fps), std::memory_order_relaxed);
+}
+
+void LiveViewGovernor::on_frame(clock::time_point now, clock::duration camera_interval, clock::duration fetch_latency, double fill)
+{
+    // While throttling the measured interval is partly our own, for cameras which do not number their frames
+    if (!m_has_frame || !m_limiting) {
+        m_camera_fps = 1.0 / std::chrono::duration<double>(camera_interval).count();
+    }
+    double ceiling = m_camera_fps;
+    double const target = m_target_fps.load(std::memory_order_relaxed);
+    if (0.0 < target) {
+        ceiling = std::min(ceiling, target);
+    }
+    ceiling = std::max(ceiling, MinFps);
+
+    double const latency = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(fetch_latency).count());
+    if (!m_has_frame) {
+        m_has_frame = true;
+        m_rate = ceiling;
+        m_latency_floor = latency;
+        m_latency_average = latency;
+    }
+    else {
+        double const elapsed = std::chrono::duration<double>(now - m_last_frame).count();
+
+        // The floor follows a faster call at once and a slower one slowly, as frames grow with the scene
+        m_latency_floor = (latency < m_latency_floor) ? latency : m_latency_floor + (latency - m_latency_floor) / 256;
+        m_latency_average += (latency - m_latency_average) / 8;
+
+        bool const backlog = BacklogFill <= fill;
+        bool const congested = CongestedFactor * m_latency_floor < m_latency_average
+            && CongestedMarginUs < m_latency_average - m_latency_floor;
+        if (backlog || congested) {
+            if (m_hold_until <= now) {
+                m_rate = std::max(MinFps, m_rate * Decrease);
+                // Let two frames at the new rate show whether that was enough
+                auto const hold = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(2.0 / m_rate));
+                m_hold_until = now + std::max<clock::duration>(MinHold, hold);
+                (backlog ? m_backlog_decreases : m_bandwidth_decreases).fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        else if (fill <= DrainedFill) {
+            m_rate += ceiling * elapsed / RampSeconds;
+        }
+        m_rate = std::min(m_rate, ceiling);
+    }
+    m_last_frame = now;
+
+    m_rate_fps.store(m_rate, std::memory_order_relaxed);
+    m_throttling.store(m_rate < ceiling, std::memory_order_relaxed);
+    m_limiting = m_rate < m_camera_fps;
+}
+
+LiveViewGovernor::clock::time_point LiveViewGovernor::earliest_poll() const
+{
+    if (!m_has_frame || !m_limiting) {
+        return clock::time_point();
+    }
+    return m_last_frame + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / m_rate));
+}
+
+} // namespace cli
@@ -0,0 +1,324 @@
+#include "LiveViewHttpServer.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace
+{
+#if defined(_WIN32) || defined(_WIN64)
+using socket_type = SOCKET;
+constexpr socket_type const NoSocket = INVALID_SOCKET;
+void close_socket(socket_type s) { ::closesocket(s); }
+void shutdown_socket(socket_type s) { ::shutdown(s, SD_BOTH); }
+#else
+using socket_type = int;
+constexpr socket_type const NoSocket = -1;
+void close_socket(socket_type s) { ::close(s); }
+void shutdown_socket(socket_type s) { ::shutdown(s, SHUT_RDWR); }
+#endif
+
+#if defined(MSG_NOSIGNAL)
+constexpr int const SendFlags = MSG_NOSIGNAL; // a closed browser tab must not SIGPIPE the CLI
+#else
+constexpr int const SendFlags = 0;
+#endif
+
+constexpr char const Boundary[] = "lvframe";
+constexpr std::size_t const MaxRequest = 4096;
+// Frames queued per client before its oldest ones are dropped
+constexpr std::size_t const ClientRingCapacity = 2;
+
+struct Chunk
+{
+    char const* data;
+    std::size_t size;
+};
+
+void set_timeouts(socket_type s, int ms)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    DWORD tv = ms;
+#else
+    struct timeval tv;
+    tv.tv_sec = ms / 1000;
+    tv.tv_usec = (ms % 1000) * 1000;
+#endif
+    ::setsockopt(s, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<char const*>(&tv), sizeof(tv));
+    ::setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<char const*>(&tv), sizeof(tv));
+}
+
+// Send all chunks, gathered into one call where the platform allows it
+bool send_all(socket_type s, Chunk* chunks, std::size_t count)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    for (std::size_t i = 0; i < count; ++i) {
+        char const* data = chunks[i].data;
+        std::size_t remaining = chunks[i].size;
+        while (0 < remaining) {
+            int sent = ::send(s, data, static_cast<int>(remaining), 0);
+            if (sent <= 0) return false;
+            data += sent;
+            remaining -= sent;
+        }
+    }
+    return true;
+#else
+    struct iovec iov[4];
+    std::size_t niov = 0;
+    for (std::size_t i = 0; i < count && niov < 4; ++i, ++niov) {
+        iov[niov].iov_base = const_cast<char*>(chunks[i].data);
+        iov[niov].iov_len = chunks[i].size;
+    }
+    struct iovec* cur = iov;
+    while (0 < niov) {
+        struct msghdr msg = {};
+        msg.msg_iov = cur;
+        msg.msg_iovlen = niov;
+        ssize_t sent = ::sendmsg(s, &msg, SendFlags);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        while (0 < niov && static_cast<std::size_t>(sent) >= cur->iov_len) {
+            sent -= cur->iov_len;
+            ++cur;
+            --niov;
+        }
+        if (0 < niov) {
+            cur->iov_base = static_cast<char*>(cur->iov_base) + sent;
+            cur->iov_len -= sent;
+        }
+    }
+    return true;
+#endif
+}
+
+bool send_text(socket_type s, char const* text)
+{
+    Chunk chunk{ text, std::strlen(text) };
+    return send_all(s, &chunk, 1);
+}
+
+// Read the request head, returns the request target of a GET or an empty string
+std::string read_request(socket_type s)
+{
+    std::string request;
+    char buf[512];
+    while (request.size() < MaxRequest && std::string::npos == request.find("\r\n\r\n")) {
+        int received = ::recv(s, buf, sizeof(buf), 0);
+        if (received <= 0) {
+            return std::string();
+        }
+        request.append(buf, received);
+    }
+    if (0 != request.compare(0, 4, "GET ")) {
+        return std::string();
+    }
+    auto const end = request.find(' ', 4);
+    if (std::string::npos == end) {
+        return std::string();
+    }
+    return request.substr(4, end - 4);
+}
+} // namespace
+
+namespace cli
+{
+LiveViewHttpServer::LiveViewHttpServer()
+    : m_stream(nullptr)
+    , m_listen(NoSocket)
+    , m_port(0)
+    , m_thread()
+    , m_running(false)
+    , m_client_list()
+    , m_clients(0)
+    , m_connections(0)
+    , m_frames_sent(0)
+{
+}
+
+LiveViewHttpServer::~LiveViewHttpServer()
+{
+    stop();
+}
+
+bool LiveViewHttpServer::start(LiveViewStream& stream, std::uint16_t port)
+{
+    if (is_running()) {
+        return false;
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    WSADATA wsa;
+    if (0 != ::WSAStartup(MAKEWORD(2, 2), &wsa)) {
+        return false;
+    }
+#endif
+
+    socket_type s = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (NoSocket == s) {
+#if defined(_WIN32) || defined(_WIN64)
+        ::WSACleanup();
+#endif
+        return false;
+    }
+    int on = 1;
+    ::setsockopt(s, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char const*>(&on), sizeof(on));
+
+    // Local consumers only
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    if (0 != ::bind(s, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) || 0 != ::listen(s, 8)) {
+        close_socket(s);
+#if defined(_WIN32) || defined(_WIN64)
+        ::WSACleanup();
+#endif
+        return false;
+    }
+
+    m_stream = &stream;
+    m_listen = s;
+    m_port = port;
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&LiveViewHttpServer::accept_loop, this);
+    return true;
+}
+
+void LiveViewHttpServer::stop()
+{
+    if (!m_thread.joinable()) {
+        return;
+    }
+    m_running.store(false, std::memory_order_release);
+    m_thread.join();
+
+    // Unblock clients stuck in send(), they notice m_running within one ring wait otherwise
+    for (auto& client : m_client_list) {
+        shutdown_socket(client.socket);
+    }
+    reap(true);
+
+    close_socket(m_listen);
+    m_listen = NoSocket;
+#if defined(_WIN32) || defined(_WIN64)
+    ::WSACleanup();
+#endif
+}
+
+void LiveViewHttpServer::accept_loop()
+{
+    while (m_running.load(std::memory_order_acquire)) {
+        reap(false);
+
+        // Wake up regularly to notice stop()
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(m_listen, &fds);
+        struct timeval tv = { 0, 200 * 1000 };
+        if (::select(static_cast<int>(m_listen + 1), &fds, nullptr, nullptr, &tv) <= 0) {
+            continue;
+        }
+        socket_type s = ::accept(m_listen, nullptr, nullptr);
+        if (NoSocket == s) {
+            continue;
+        }
+
+        int on = 1;
+        ::setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char const*>(&on), sizeof(on));
+#if defined(SO_NOSIGPIPE)
+        ::setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+        set_timeouts(s, 2000);
+
+        m_client_list.emplace_back();
+        auto& client = m_client_list.back();
+        client.socket = s;
+        client.ring = m_stream->subscribe(ClientRingCapacity);
+        client.done.store(false, std::memory_order_relaxed);
+        client.thread = std::thread(&LiveViewHttpServer::serve, this, &client);
+        m_clients.fetch_add(1, std::memory_order_relaxed);
+        m_connections.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LiveViewHttpServer::serve(Client* client)
+{
+    auto const target = read_request(client->socket);
+    if (target.empty()) {
+        send_text(client->socket, "HTTP/1.0 400 Bad Request\r\nConnection: close\r\n\r\n");
+    }
+    else if (target != "/" && 0 != target.compare(0, 7, "/stream") && '?' != target[1]) {
+        send_text(client->socket, "HTTP/1.0 404 Not Found\r\nConnection: close\r\n\r\n");
+    }
+    else {
+        char head[256];
+        std::snprintf(head, sizeof(head),
+            "HTTP/1.0 200 OK\r\n"
+            "Content-Type: multipart/x-mixed-replace; boundary=%s\r\n"
+            "Cache-Control: no-cache, no-store\r\n"
+            "Pragma: no-cache\r\n"
+            "Connection: close\r\n"
+            "\r\n", Boundary);
+        bool ok = send_text(client->socket, head);
+
+        char part[128];
+        while (ok && m_running.load(std::memory_order_acquire)) {
+            LiveViewFrame* frame = client->ring->pop_wait(500ms);
+            if (!frame) {
+                continue;
+            }
+            int const part_size = std::snprintf(part, sizeof(part),
+                "--%s\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n", Boundary, frame->size);
+            // The JPEG goes out straight from the pooled frame buffer
+            Chunk chunks[] = {
+                { part, static_cast<std::size_t>(part_size) },
+                { reinterpret_cast<char const*>(frame->data), frame->size },
+                { "\r\n", 2 },
+            };
+            ok = send_all(client->socket, chunks, 3);
+            LiveViewFramePool::release(frame);
+            if (ok) {
+                m_frames_sent.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // The socket is closed by reap(), so stop() can still shut it down safely
+    m_stream->unsubscribe(client->ring);
+    m_clients.fetch_sub(1, std::memory_order_relaxed);
+    client->done.store(true, std::memory_order_release);
+}
+
+void LiveViewHttpServer::reap(bool all)
+{
+    for (auto it = m_client_list.begin(); it != m_client_list.end();) {
+        if (all || it->done.load(std::memory_order_acquire)) {
+            it->thread.join();
+            close_socket(it->socket);
+            it = m_client_list.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+} // namespace cli
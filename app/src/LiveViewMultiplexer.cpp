@@ -0,0 +1,130 @@
+#include "LiveViewMultiplexer.h"
+#include <algorithm>
+
+namespace cli
+{
+LiveViewMultiplexer::LiveViewMultiplexer(std::size_t ring_capacity, std::size_t held)
+    : m_ring_capacity(ring_capacity)
+    , m_held(held)
+    , m_signal(std::make_shared<LiveViewFrameSignal>())
+    , m_sources(std::make_shared<SourceList const>())
+    , m_sources_mtx()
+    , m_next(0)
+    , m_popped(0)
+{
+}
+
+LiveViewMultiplexer::~LiveViewMultiplexer()
+{
+    clear();
+}
+
+bool LiveViewMultiplexer::add(std::int32_t camera, LiveViewStream& stream)
+{
+    std::lock_guard<std::mutex> lock(m_sources_mtx);
+    auto const current = std::atomic_load(&m_sources);
+    auto const found = std::find_if(current->begin(), current->end(),
+        [camera](Source const& source) { return source.camera == camera; });
+    if (found != current->end()) {
+        return false;
+    }
+
+    auto ring = std::make_shared<LiveViewFrameRing>(m_ring_capacity, m_signal);
+    stream.subscribe(ring, m_held);
+    auto list = std::make_shared<SourceList>(*current);
+    list->push_back(Source{ camera, &stream, ring });
+    std::atomic_store(&m_sources, std::shared_ptr<SourceList const>(list));
+    return true;
+}
+
+void LiveViewMultiplexer::remove(std::int32_t camera)
+{
+    std::shared_ptr<LiveViewFrameRing> ring;
+    LiveViewStream* stream = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_sources_mtx);
+        auto list = std::make_shared<SourceList>(*std::atomic_load(&m_sources));
+        auto const found = std::find_if(list->begin(), list->end(),
+            [camera](Source const& source) { return source.camera == camera; });
+        if (found == list->end()) {
+            return;
+        }
+        ring = found->ring;
+        stream = found->stream;
+        list->erase(found);
+        std::atomic_store(&m_sources, std::shared_ptr<SourceList const>(list));
+    }
+    stream->unsubscribe(ring);
+}
+
+void LiveViewMultiplexer::clear()
+{
+    std::shared_ptr<SourceList const> old;
+    {
+        std::lock_guard<std::mutex> lock(m_sources_mtx);
+        old = std::atomic_load(&m_sources);
+        std::atomic_store(&m_sources, std::make_shared<SourceList const>());
+    }
+    for (auto const& source : *old) {
+        source.stream->unsubscribe(source.ring);
+    }
+}
+
+LiveViewFrame* LiveViewMultiplexer::pop()
+{
+    auto const sources = std::atomic_load(&m_sources);
+    std::size_t const count = sources->size();
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t const index = (m_next + i) % count;
+        if (LiveViewFrame* frame = (*sources)[index].ring->pop()) {
+            m_next = index + 1;
+            m_popped.fetch_add(1, std::memory_order_relaxed);
+            return frame;
+        }
+    }
+    return nullptr;
+}
+
+LiveViewFrame* LiveViewMultiplexer::pop_wait(std::chrono::milliseconds timeout)
+{
+    return m_signal->wait(timeout, [this] { return pop(); });
+}
+
+std::shared_ptr<LiveViewFrameRing> LiveViewMultiplexer::queue(std::int32_t camera) const
+{
+    auto const sources = std::atomic_load(&m_sources);
+    for (auto const& source : *sources) {
+        if (source.camera == camera) {
+            return source.ring;
+        }
+    }
+    return nullptr;
+}
+
+std::size_t LiveViewMultiplexer::size() const
+{
+    return std::atomic_load(&m_sources)->size();
+}
+
+std::vector<std::int32_t> LiveViewMultiplexer::cameras() const
+{
+    auto const sources = std::atomic_load(&m_sources);
+    std::vector<std::int32_t> numbers;
+    numbers.reserve(sources->size());
+    for (auto const& source : *sources) {
+        numbers.push_back(source.camera);
+    }
+    return numbers;
+}
+
+std::uint64_t LiveViewMultiplexer::dropped() const
+{
+    auto const sources = std::atomic_load(&m_sources);
+    std::uint64_t total = 0;
+    for (auto const& source : *sources) {
+        total += source.ring->dropped();
+    }
+    return total;
+}
+
+} // namespace cli
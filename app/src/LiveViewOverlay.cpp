@@ -0,0 +1,178 @@
+#include "LiveViewOverlay.h"
+#include <cstring>
+#include "CameraRemote_SDK.h"
+
+namespace SDK = SCRSDK;
+
+namespace
+{
+bool normalize(CrInt32u x_num, CrInt32u x_den, CrInt32u y_num, CrInt32u y_den,
+    CrInt32u width, CrInt32u height, cli::LiveViewOverlayRect& rect)
+{
+    if (0 == x_den || 0 == y_den) {
+        return false;
+    }
+    rect.x = static_cast<float>(x_num) / x_den;
+    rect.y = static_cast<float>(y_num) / y_den;
+    rect.width = static_cast<float>(width) / x_den;
+    rect.height = static_cast<float>(height) / y_den;
+    return true;
+}
+
+void set_selected(SDK::CrFaceFrameInfo const& info, cli::LiveViewOverlayRect& rect)
+{
+    rect.selected = static_cast<std::uint8_t>(info.isSelected);
+}
+
+template <typename Info>
+void set_selected(Info const&, cli::LiveViewOverlayRect& rect)
+{
+    rect.selected = 0;
+}
+
+// Decode the packed SDK frame infos of one property into rects, returns the number decoded
+template <typename Info>
+std::uint8_t decode_frames(SDK::CrLiveViewProperty& property, cli::LiveViewOverlayRect* rects, std::size_t max, bool& truncated)
+{
+    CrInt8u const* value = property.GetValue();
+    std::size_t const count = value ? property.GetValueSize() / sizeof(Info) : 0;
+    if (max < count) {
+        truncated = true;
+    }
+
+    std::size_t decoded = 0;
+    for (std::size_t i = 0; i < count && decoded < max; ++i) {
+        Info info;
+        std::memcpy(static_cast<void*>(&info), value + i * sizeof(Info), sizeof(Info)); // pack(1), unaligned
+        auto& rect = rects[decoded];
+        if (!normalize(info.xNumerator, info.xDenominator, info.yNumerator, info.yDenominator, info.width, info.height, rect)) {
+            continue;
+        }
+        rect.type = static_cast<std::uint16_t>(info.type);
+        rect.state = static_cast<std::uint16_t>(info.state);
+        rect.priority = info.priority;
+        set_selected(info, rect);
+        rect.reserved = 0;
+        ++decoded;
+    }
+    return static_cast<std::uint8_t>(decoded);
+}
+
+bool decode_magnifier(SDK::CrLiveViewProperty& property, cli::LiveViewOverlayRect& rect)
+{
+    CrInt8u const* value = property.GetValue();
+    if (!value || property.GetValueSize() < sizeof(SDK::CrMagPosInfo)) {
+        return false;
+    }
+    SDK::CrMagPosInfo info;
+    std::memcpy(static_cast<void*>(&info), value, sizeof(info));
+    if (!normalize(info.xNumerator, info.xDenominator, info.yNumerator, info.yDenominator, info.width, info.height, rect)) {
+        return false;
+    }
+    rect.type = 0;
+    rect.state = 0;
+    rect.priority = 0;
+    rect.selected = 0;
+    rect.reserved = 0;
+    return true;
+}
+} // namespace
+
+namespace cli
+{
+LiveViewOverlayBuffer::LiveViewOverlayBuffer()
+    : m_slots()
+    , m_front(0)
+    , m_version(0)
+{
+    for (auto& slot : m_slots) {
+        slot.seq.store(0, std::memory_order_relaxed);
+        std::memset(&slot.overlay, 0, sizeof(slot.overlay));
+    }
+}
+
+void LiveViewOverlayBuffer::update(SDK::CrLiveViewProperty* properties, std::int32_t count)
+{
+    auto const& front = m_slots[m_front.load(std::memory_order_relaxed)].overlay;
+    Slot& back = begin_write();
+    auto& overlay = back.overlay;
+
+    // Properties which did not change keep their last decoded frames
+    std::memcpy(&overlay, &front, sizeof(overlay));
+    overlay.version = front.version + 1;
+    overlay.truncated = false;
+
+    for (std::int32_t i = 0; i < count; ++i) {
+        auto& property = properties[i];
+        overlay.time_code = property.GetTimeCode();
+        bool const enabled = SDK::CrEnableValue_NotSupported != property.GetPropertyEnableFlag();
+
+        switch (property.GetFrameInfoType()) {
+        case SDK::CrFrameInfoType_FocusFrameInfo:
+            overlay.focus_count = enabled
+                ? decode_frames<SDK::CrFocusFrameInfo>(property, overlay.focus, LiveViewOverlay::MaxFocusFrames, overlay.truncated)
+                : 0;
+            break;
+        case SDK::CrFrameInfoType_FaceFrameInfo:
+            overlay.face_count = enabled
+                ? decode_frames<SDK::CrFaceFrameInfo>(property, overlay.face, LiveViewOverlay::MaxFaceFrames, overlay.truncated)
+                : 0;
+            break;
+        case SDK::CrFrameInfoType_TrackingFrameInfo:
+            overlay.tracking_count = enabled
+                ? decode_frames<SDK::CrTrackingFrameInfo>(property, overlay.tracking, LiveViewOverlay::MaxTrackingFrames, overlay.truncated)
+                : 0;
+            break;
+        case SDK::CrFrameInfoType_Magnifier_Position:
+            overlay.has_magnifier = enabled && decode_magnifier(property, overlay.magnifier);
+            break;
+        default:
+            break;
+        }
+    }
+
+    end_write(back);
+}
+
+void LiveViewOverlayBuffer::clear()
+{
+    auto const version = m_slots[m_front.load(std::memory_order_relaxed)].overlay.version;
+    Slot& back = begin_write();
+    std::memset(&back.overlay, 0, sizeof(back.overlay));
+    back.overlay.version = version + 1;
+    end_write(back);
+}
+
+void LiveViewOverlayBuffer::read(LiveViewOverlay& overlay) const
+{
+    for (;;) {
+        Slot const& slot = m_slots[m_front.load(std::memory_order_acquire)];
+        auto const seq = slot.seq.load(std::memory_order_acquire);
+        if (seq & 1) {
+            continue; // flipped twice meanwhile and the writer is back on this slot
+        }
+        std::memcpy(&overlay, &slot.overlay, sizeof(overlay));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == seq) {
+            return;
+        }
+    }
+}
+
+LiveViewOverlayBuffer::Slot& LiveViewOverlayBuffer::begin_write()
+{
+    Slot& slot = m_slots[1 - m_front.load(std::memory_order_relaxed)];
+    auto const seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return slot;
+}
+
+void LiveViewOverlayBuffer::end_write(Slot& slot)
+{
+    slot.seq.store(slot.seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    m_front.store(static_cast<std::uint32_t>(&slot - m_slots), std::memory_order_release);
+    m_version.store(slot.overlay.version, std::memory_order_release);
+}
+
+} // namespace cli
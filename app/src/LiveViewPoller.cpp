@@ -0,0 +1,102 @@
+#include "LiveViewPoller.h"
+#include <algorithm>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Until two frames have been seen assume ~30fps
+constexpr std::chrono::microseconds const InitialInterval = 33333us;
+constexpr std::chrono::microseconds const MinInterval = 5ms;
+constexpr std::chrono::microseconds const MaxInterval = 500ms;
+constexpr std::chrono::microseconds const MinRetry = 1ms;
+// Larger frame number jumps are treated as a counter reset, not as lost frames
+constexpr CrInt32u const MaxFrameGap = 1000;
+} // namespace
+
+namespace cli
+{
+LiveViewPoller::LiveViewPoller()
+    : m_has_frame(false)
+    , m_last_frame_no(0)
+    , m_last_arrival()
+    , m_next_poll()
+    , m_interval(InitialInterval)
+    , m_misses(0)
+    , m_frames(0)
+    , m_duplicated(0)
+    , m_skipped(0)
+    , m_retries(0)
+    , m_interval_us(0)
+{
+}
+
+void LiveViewPoller::reset()
+{
+    m_has_frame = false;
+    m_last_frame_no = 0;
+    m_next_poll = clock::time_point();
+    m_interval = InitialInterval;
+    m_misses = 0;
+}
+
+bool LiveViewPoller::on_frame(CrInt32u frame_no, clock::time_point now)
+{
+    if (!m_has_frame) {
+        m_has_frame = true;
+        m_last_frame_no = frame_no;
+        m_last_arrival = now;
+        m_next_poll = now + m_interval - retry_delay();
+        m_misses = 0;
+        m_frames.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Cameras which do not number their frames always report 0
+    CrInt32u gap = frame_no - m_last_frame_no;
+    if (0 == gap && 0 != frame_no) {
+        m_duplicated.fetch_add(1, std::memory_order_relaxed);
+        on_not_updated(now);
+        return false;
+    }
+    if (0 == gap || MaxFrameGap < gap) {
+        gap = 1;
+    }
+    if (1 < gap) {
+        m_skipped.fetch_add(gap - 1, std::memory_order_relaxed);
+    }
+
+    // The arrival time is quantized by our own polling: a late poll shows up as missed
+    // frames (shorter sample), an early one as NotUpdated retries (longer sample).
+    auto const sample = (now - m_last_arrival) / gap;
+    m_interval += (sample - m_interval) / 8;
+    m_interval = std::clamp<clock::duration>(m_interval, MinInterval, MaxInterval);
+    m_interval_us.store(std::chrono::duration_cast<std::chrono::microseconds>(m_interval).count(), std::memory_order_relaxed);
+
+    m_last_frame_no = frame_no;
+    m_last_arrival = now;
+    m_next_poll = now + m_interval - retry_delay();
+    m_misses = 0;
+    m_frames.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void LiveViewPoller::on_not_updated(clock::time_point now)
+{
+    ++m_misses;
+    m_retries.fetch_add(1, std::memory_order_relaxed);
+    if (m_has_frame && now - m_last_arrival < 2 * m_interval) {
+        m_next_poll = now + retry_delay();
+    }
+    else {
+        // Camera stalled or not started yet, do not spin
+        m_next_poll = now + std::min<clock::duration>(m_interval, 4 * retry_delay() * m_misses);
+    }
+}
+
+LiveViewPoller::clock::duration LiveViewPoller::retry_delay() const
+{
+    return std::max<clock::duration>(MinRetry, m_interval / 16);
+}
+
+} // namespace cli
@@ -0,0 +1,248 @@
+#include "LiveViewSharedMemory.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#if defined(__APPLE__) || defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Slot payload capacity never goes below this, live-view JPEGs are usually well under it
+constexpr std::uint32_t const MinSlotSize = 512 * 1024;
+constexpr std::uint32_t const SlotAlignment = 64;
+
+std::uint32_t align_up(std::uint32_t value, std::uint32_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+namespace cli
+{
+LiveViewShmPublisher::LiveViewShmPublisher()
+    : m_stream(nullptr)
+    , m_ring()
+    , m_thread()
+    , m_running(false)
+    , m_name()
+    , m_header(nullptr)
+    , m_length(0)
+    , m_published(0)
+    , m_oversized(0)
+{
+}
+
+LiveViewShmPublisher::~LiveViewShmPublisher()
+{
+    stop();
+}
+
+bool LiveViewShmPublisher::start(LiveViewStream& stream, std::string const& name, std::uint32_t slot_count)
+{
+#if defined(__APPLE__) || defined(__linux__)
+    if (is_running() || 0 == slot_count) {
+        return false;
+    }
+
+    auto const slot_size = align_up(std::max(MinSlotSize, stream.pool().buffer_size()), SlotAlignment);
+    auto const slot_stride = align_up(static_cast<std::uint32_t>(sizeof(shm::ShmSlot)) + slot_size, SlotAlignment);
+    std::size_t const length = sizeof(shm::ShmHeader) + static_cast<std::size_t>(slot_stride) * slot_count;
+
+    // Start from a fresh segment, a reader still mapping an old one keeps its copy
+    ::shm_unlink(name.c_str());
+    int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    if (0 != ::ftruncate(fd, static_cast<off_t>(length))) {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        return false;
+    }
+    void* base = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == base) {
+        ::shm_unlink(name.c_str());
+        return false;
+    }
+
+    // ftruncate() zero-fills: every seq starts even and published at 0
+    auto* header = new (base) shm::ShmHeader;
+    header->magic = shm::Magic;
+    header->version = shm::Version;
+    header->slot_count = slot_count;
+    header->slot_size = slot_size;
+    header->slot_stride = slot_stride;
+    header->published.store(0, std::memory_order_release);
+    for (std::uint32_t i = 0; i < slot_count; ++i) {
+        auto* slot = new (shm::slot(header, i)) shm::ShmSlot;
+        slot->seq.store(0, std::memory_order_relaxed);
+    }
+
+    m_stream = &stream;
+    m_name = name;
+    m_header = header;
+    m_length = length;
+    m_ring = stream.subscribe(2);
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&LiveViewShmPublisher::run, this);
+    return true;
+#else
+    (void)stream;
+    (void)name;
+    (void)slot_count;
+    return false;
+#endif
+}
+
+void LiveViewShmPublisher::stop()
+{
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    if (m_ring) {
+        m_stream->unsubscribe(m_ring);
+        m_ring.reset();
+    }
+#if defined(__APPLE__) || defined(__linux__)
+    if (m_header) {
+        ::munmap(m_header, m_length);
+        ::shm_unlink(m_name.c_str());
+        m_header = nullptr;
+        m_length = 0;
+    }
+#endif
+}
+
+void LiveViewShmPublisher::run()
+{
+    while (m_running.load(std::memory_order_acquire)) {
+        LiveViewFrame* frame = m_ring->pop_wait(100ms);
+        if (!frame) {
+            continue;
+        }
+        publish(frame);
+        LiveViewFramePool::release(frame);
+    }
+}
+
+void LiveViewShmPublisher::publish(LiveViewFrame const* frame)
+{
+    if (m_header->slot_size < frame->size) {
+        m_oversized.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    auto const index = m_header->published.load(std::memory_order_relaxed);
+    auto* slot = shm::slot(m_header, index);
+    auto const seq = slot->seq.load(std::memory_order_relaxed);
+
+    // Odd while the slot is rewritten, the fence keeps the writes below after it
+    slot->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot->frame_no = frame->frame_no;
+    slot->size = frame->size;
+    slot->time_code = frame->time_code;
+    slot->host_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(frame->timestamp.time_since_epoch()).count();
+    slot->index = index;
+    std::memcpy(const_cast<std::uint8_t*>(shm::payload(slot)), frame->data, frame->size);
+
+    slot->seq.store(seq + 2, std::memory_order_release);
+    m_header->published.store(index + 1, std::memory_order_release);
+    m_published.fetch_add(1, std::memory_order_relaxed);
+}
+
+LiveViewShmReader::LiveViewShmReader()
+    : m_header(nullptr)
+    , m_length(0)
+{
+}
+
+LiveViewShmReader::~LiveViewShmReader()
+{
+    close();
+}
+
+bool LiveViewShmReader::open(std::string const& name)
+{
+    close();
+#if defined(__APPLE__) || defined(__linux__)
+    int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (0 != ::fstat(fd, &st) || st.st_size < static_cast<off_t>(sizeof(shm::ShmHeader))) {
+        ::close(fd);
+        return false;
+    }
+    void* base = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == base) {
+        return false;
+    }
+
+    auto const* header = static_cast<shm::ShmHeader const*>(base);
+    std::size_t const length = static_cast<std::size_t>(st.st_size);
+    if (shm::Magic != header->magic || shm::Version != header->version || 0 == header->slot_count
+        || header->slot_stride < sizeof(shm::ShmSlot) + header->slot_size
+        || length < sizeof(shm::ShmHeader) + static_cast<std::size_t>(header->slot_stride) * header->slot_count) {
+        ::munmap(base, length);
+        return false;
+    }
+    m_header = header;
+    m_length = length;
+    return true;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+void LiveViewShmReader::close()
+{
+#if defined(__APPLE__) || defined(__linux__)
+    if (m_header) {
+        ::munmap(const_cast<shm::ShmHeader*>(m_header), m_length);
+    }
+#endif
+    m_header = nullptr;
+    m_length = 0;
+}
+
+std::uint64_t LiveViewShmReader::published() const
+{
+    return m_header->published.load(std::memory_order_acquire);
+}
+
+shm::ShmSlot const* LiveViewShmReader::acquire(std::uint64_t index, std::uint32_t& seq) const
+{
+    if (published() <= index) {
+        return nullptr; // not written yet, a zeroed slot would pass for frame 0
+    }
+    auto const* slot = shm::slot(m_header, index);
+    seq = slot->seq.load(std::memory_order_acquire);
+    if (seq & 1) {
+        return nullptr; // being rewritten
+    }
+    if (slot->index != index || m_header->slot_size < slot->size || !valid(slot, seq)) {
+        return nullptr; // another frame, or overwritten while looking
+    }
+    return slot;
+}
+
+bool LiveViewShmReader::valid(shm::ShmSlot const* slot, std::uint32_t seq) const
+{
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot->seq.load(std::memory_order_relaxed) == seq;
+}
+
+} // namespace cli
@@ -0,0 +1,321 @@
+#include "LiveViewStream.h"
+#include <algorithm>
+#include <chrono>
+#include "JpegValidator.h"
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace SDK = SCRSDK;
+using namespace std::chrono_literals;
+
+namespace
+{
+#if defined(__linux__)
+// Cores the process may run on, taken during static initialization before any thread is pinned.
+// sched_getaffinity() of a pinned thread only returns its own pinned mask.
+cpu_set_t startup_affinity()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (0 != sched_getaffinity(0, sizeof(set), &set)) {
+        for (long cpu = 0; cpu < sysconf(_SC_NPROCESSORS_ONLN) && cpu < CPU_SETSIZE; ++cpu) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return set;
+}
+
+cpu_set_t const StartupAffinity = startup_affinity();
+#endif
+
+// Restrict the calling thread to cpu, or to every core of the process again for -1
+bool pin_current_thread(int cpu)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    DWORD_PTR process_mask = 0;
+    DWORD_PTR system_mask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+        return false;
+    }
+    DWORD_PTR mask = process_mask;
+    if (0 <= cpu) {
+        if (static_cast<int>(sizeof(DWORD_PTR) * 8) <= cpu) {
+            return false;
+        }
+        mask = static_cast<DWORD_PTR>(1) << cpu;
+    }
+    return 0 != SetThreadAffinityMask(GetCurrentThread(), mask);
+#elif defined(__linux__)
+    cpu_set_t set = StartupAffinity;
+    if (0 <= cpu) {
+        CPU_ZERO(&set);
+        if (CPU_SETSIZE <= cpu) {
+            return false;
+        }
+        CPU_SET(cpu, &set);
+    }
+    return 0 == pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    // macOS has no hard affinity, the scheduler places the thread
+    return cpu < 0;
+#endif
+}
+} // namespace
+
+namespace cli
+{
+LiveViewStream::LiveViewStream(std::size_t pool_frames)
+    : m_device_handle(0)
+    , m_open(false)
+    , m_camera(0)
+    , m_pool(pool_frames)
+    , m_fetched(0)
+    , m_not_updated(0)
+    , m_memory_insufficient(0)
+    , m_pool_exhausted(0)
+    , m_fetch_failed(0)
+    , m_invalid_frames(0)
+    , m_thread()
+    , m_running(false)
+    , m_cpu(-1)
+    , m_pinned(false)
+    , m_poller()
+    , m_governor()
+    , m_fetch_latency()
+    , m_frame_interval()
+    , m_retries_per_frame()
+    , m_subscribers(std::make_shared<SubscriberList const>())
+    , m_subscribers_mtx()
+    , m_subscribed_frames(0)
+    , m_publish_mtx()
+{
+}
+
+LiveViewStream::~LiveViewStream()
+{
+    stop();
+}
+
+SDK::CrError LiveViewStream::open(SDK::CrDeviceHandle device_handle)
+{
+    m_device_handle = device_handle;
+    auto err = update_buffer_size();
+    m_open = CR_SUCCEEDED(err);
+    return err;
+}
+
+void LiveViewStream::close()
+{
+    stop();
+    // Pooled buffers are kept, a later open() on the same camera reuses them
+    m_open = false;
+    m_device_handle = 0;
+}
+
+SDK::CrError LiveViewStream::fetch(LiveViewFrame*& frame)
+{
+    frame = nullptr;
+    if (!m_open) {
+        return SDK::CrError_Generic_InvalidHandle;
+    }
+
+    LiveViewFrame* pooled = m_pool.acquire();
+    if (!pooled) {
+        m_pool_exhausted.fetch_add(1, std::memory_order_relaxed);
+        return SDK::CrError_Memory_OutOfMemory;
+    }
+
+    auto const requested = std::chrono::steady_clock::now();
+    auto err = SDK::GetLiveViewImage(m_device_handle, &pooled->block);
+    auto const returned = std::chrono::steady_clock::now();
+    m_fetch_latency.record(std::chrono::duration_cast<std::chrono::microseconds>(returned - requested).count());
+    if (CR_FAILED(err)) {
+        m_pool.release(pooled);
+        if (err == SDK::CrWarning_Frame_NotUpdated) {
+            m_not_updated.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (err == SDK::CrError_Memory_Insufficient) {
+            // The image no longer fits, frames are regrown on their next acquire()
+            m_memory_insufficient.fetch_add(1, std::memory_order_relaxed);
+            update_buffer_size();
+        }
+        return err;
+    }
+
+    if (pooled->block.GetImageSize() < 1) {
+        m_pool.release(pooled);
+        return SDK::CrWarning_Frame_NotUpdated;
+    }
+    if (!is_valid_jpeg(pooled->block.GetImageData(), pooled->block.GetImageSize())) {
+        // Truncated or corrupt, never hand it to consumers; retried like a frame not yet updated
+        m_pool.release(pooled);
+        m_invalid_frames.fetch_add(1, std::memory_order_relaxed);
+        return SDK::CrWarning_Frame_NotUpdated;
+    }
+
+    pooled->data = pooled->block.GetImageData();
+    pooled->size = pooled->block.GetImageSize();
+    pooled->frame_no = pooled->block.GetFrameNo();
+    pooled->time_code = pooled->block.GetTimeCode();
+    pooled->camera = m_camera;
+    pooled->timestamp = returned;
+    m_fetched.fetch_add(1, std::memory_order_relaxed);
+
+    frame = pooled;
+    return SDK::CrError_None;
+}
+
+bool LiveViewStream::start()
+{
+    if (!m_open || m_running.load(std::memory_order_acquire)) {
+        return false;
+    }
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&LiveViewStream::run, this);
+    return true;
+}
+
+void LiveViewStream::stop()
+{
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+std::shared_ptr<LiveViewFrameRing> LiveViewStream::subscribe(std::size_t capacity, std::size_t held)
+{
+    auto ring = std::make_shared<LiveViewFrameRing>(capacity);
+    subscribe(ring, held);
+    return ring;
+}
+
+void LiveViewStream::subscribe(std::shared_ptr<LiveViewFrameRing> const& ring, std::size_t held)
+{
+    std::lock_guard<std::mutex> lock(m_subscribers_mtx);
+    std::size_t const frames = ring->capacity() + held;
+    // One more for the frame the fetch thread is filling, before the ring can get a frame
+    m_subscribed_frames += frames;
+    m_pool.grow_to(m_subscribed_frames + 1);
+    auto list = std::make_shared<SubscriberList>(*std::atomic_load(&m_subscribers));
+    list->push_back(Subscriber{ ring, frames });
+    std::atomic_store(&m_subscribers, std::shared_ptr<SubscriberList const>(list));
+}
+
+void LiveViewStream::unsubscribe(std::shared_ptr<LiveViewFrameRing> const& ring)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_subscribers_mtx);
+        auto list = std::make_shared<SubscriberList>(*std::atomic_load(&m_subscribers));
+        auto const found = std::find_if(list->begin(), list->end(),
+            [&ring](Subscriber const& subscriber) { return subscriber.ring == ring; });
+        if (found != list->end()) {
+            // The pool keeps its frames for the next subscriber
+            m_subscribed_frames -= found->frames;
+            list->erase(found);
+            std::atomic_store(&m_subscribers, std::shared_ptr<SubscriberList const>(list));
+        }
+    }
+    // A publish which took the old list may still be pushing to ring; once it is done
+    // every later publish sees the new list, so nothing reaches ring after the clear.
+    {
+        std::lock_guard<std::mutex> lock(m_publish_mtx);
+    }
+    ring->clear();
+}
+
+void LiveViewStream::run()
+{
+    m_poller.reset();
+    m_governor.reset();
+    bool has_frame = false;
+    std::chrono::steady_clock::time_point last_frame;
+    std::uint64_t retries = 0;
+    int applied_cpu = -1;
+    m_pinned.store(false, std::memory_order_relaxed);
+    while (m_running.load(std::memory_order_acquire)) {
+        int const cpu = m_cpu.load(std::memory_order_relaxed);
+        if (cpu != applied_cpu) {
+            m_pinned.store(pin_current_thread(cpu) && 0 <= cpu, std::memory_order_relaxed);
+            applied_cpu = cpu;
+        }
+        std::this_thread::sleep_until(std::max(m_poller.next_poll(), m_governor.earliest_poll()));
+
+        LiveViewFrame* frame = nullptr;
+        auto const requested = std::chrono::steady_clock::now();
+        auto err = fetch(frame);
+        if (CR_SUCCEEDED(err)) {
+            if (m_poller.on_frame(frame->frame_no, frame->timestamp)) {
+                if (has_frame) {
+                    m_frame_interval.record(std::chrono::duration_cast<std::chrono::microseconds>(frame->timestamp - last_frame).count());
+                }
+                m_retries_per_frame.record(retries);
+                has_frame = true;
+                last_frame = frame->timestamp;
+                retries = 0;
+                double const fill = publish(frame);
+                m_governor.on_frame(frame->timestamp, m_poller.frame_interval(), frame->timestamp - requested, fill);
+            }
+            else {
+                ++retries;
+            }
+            release(frame);
+            continue;
+        }
+
+        if (err == SDK::CrWarning_Frame_NotUpdated
+            || err == SDK::CrError_Memory_Insufficient
+            || err == SDK::CrError_Memory_OutOfMemory) {
+            ++retries;
+            m_poller.on_not_updated(LiveViewPoller::clock::now());
+        }
+        else {
+            // Connection lost or reconnecting, back off
+            m_fetch_failed.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::sleep_for(100ms);
+        }
+    }
+}
+
+double LiveViewStream::publish(LiveViewFrame* frame)
+{
+    double fill = 0.0;
+    std::lock_guard<std::mutex> lock(m_publish_mtx);
+    auto subscribers = std::atomic_load(&m_subscribers);
+    for (auto const& subscriber : *subscribers) {
+        auto const& ring = subscriber.ring;
+        fill = std::max(fill, static_cast<double>(ring->size()) / ring->capacity());
+        LiveViewFramePool::add_ref(frame);
+        ring->push(frame);
+    }
+    return fill;
+}
+
+void LiveViewStream::reset_histograms()
+{
+    m_fetch_latency.reset();
+    m_frame_interval.reset();
+    m_retries_per_frame.reset();
+}
+
+SDK::CrError LiveViewStream::update_buffer_size()
+{
+    SDK::CrImageInfo inf;
+    auto err = SDK::GetLiveViewImageInfo(m_device_handle, &inf);
+    if (CR_FAILED(err)) {
+        return err;
+    }
+    CrInt32u const buffer_size = inf.GetBufferSize();
+    if (buffer_size < 1) {
+        return SDK::CrError_Generic_InvalidParameter;
+    }
+    m_pool.reserve(buffer_size);
+    return SDK::CrError_None;
+}
+
+} // namespace cli
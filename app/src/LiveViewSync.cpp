@@ -0,0 +1,329 @@
+#include "LiveViewSync.h"
+#include <algorithm>
+
+namespace
+{
+constexpr CrInt32u const DropFrameFlag = 0x40;
+
+// -1 unless both nibbles are decimal and the value is below limit
+int from_bcd(CrInt32u byte, CrInt32u tens_mask, int limit)
+{
+    int const units = static_cast<int>(byte & 0x0F);
+    int const tens = static_cast<int>((byte >> 4) & tens_mask);
+    if (9 < units || 9 < tens) {
+        return -1;
+    }
+    int const value = tens * 10 + units;
+    return value < limit ? value : -1;
+}
+
+// Frame numbers skipped at the start of every minute but each tenth
+std::int64_t dropped_per_minute(std::uint32_t fps, bool drop_frame)
+{
+    return (drop_frame && 0 == fps % 30) ? fps / 15 : 0;
+}
+} // namespace
+
+namespace cli
+{
+std::int64_t time_code_to_frames(CrInt32u time_code, std::uint32_t fps)
+{
+    if (0 == fps) {
+        return -1;
+    }
+    int const hours = from_bcd(time_code >> 24, 0x3, 24);
+    int const minutes = from_bcd(time_code >> 16, 0x7, 60);
+    int const seconds = from_bcd(time_code >> 8, 0x7, 60);
+    int const frames = from_bcd(time_code, 0x3, static_cast<int>(fps));
+    if (hours < 0 || minutes < 0 || seconds < 0 || frames < 0) {
+        return -1;
+    }
+
+    std::int64_t const total_minutes = hours * 60 + minutes;
+    std::int64_t const drop = dropped_per_minute(fps, 0 != (time_code & DropFrameFlag));
+    return (total_minutes * 60 + seconds) * fps + frames - drop * (total_minutes - total_minutes / 10);
+}
+
+std::int64_t time_code_day_frames(std::uint32_t fps, bool drop_frame)
+{
+    std::int64_t const minutes = 24 * 60;
+    return minutes * 60 * fps - dropped_per_minute(fps, drop_frame) * (minutes - minutes / 10);
+}
+
+LiveViewSync::LiveViewSync(LiveViewMultiplexer& mux, LiveViewSyncConfig const& config)
+    : m_mux(mux)
+    , m_config(config)
+    , m_drop_frame(false)
+    , m_day_frames(time_code_day_frames(config.fps, false))
+    , m_channels()
+    , m_sets(0)
+{
+    m_config.max_buffered = std::max<std::size_t>(1, std::min(m_config.max_buffered, MaxBuffered));
+    for (auto& channel : m_channels) {
+        channel.camera = 0;
+        clear(channel);
+    }
+}
+
+LiveViewSync::~LiveViewSync()
+{
+    for (auto& channel : m_channels) {
+        clear(channel);
+    }
+}
+
+bool LiveViewSync::next(LiveViewSyncSet& set, std::chrono::milliseconds timeout)
+{
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    for (;;) {
+        while (LiveViewFrame* frame = m_mux.pop()) {
+            accept(frame);
+        }
+        if (match(set)) {
+            return true;
+        }
+
+        auto const now = std::chrono::steady_clock::now();
+        if (deadline <= now) {
+            return false;
+        }
+        LiveViewFrame* frame = m_mux.pop_wait(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) + std::chrono::milliseconds(1));
+        if (frame) {
+            accept(frame);
+        }
+    }
+}
+
+void LiveViewSync::release(LiveViewSyncSet& set)
+{
+    for (std::size_t i = 0; i < set.count; ++i) {
+        LiveViewFramePool::release(set.frames[i]);
+        set.frames[i] = nullptr;
+    }
+    set.count = 0;
+}
+
+void LiveViewSync::reset()
+{
+    for (auto& channel : m_channels) {
+        clear(channel);
+        channel.camera = 0;
+    }
+    m_sets = 0;
+}
+
+std::vector<LiveViewSyncStats> LiveViewSync::stats() const
+{
+    std::vector<LiveViewSyncStats> result;
+    for (auto const& channel : m_channels) {
+        if (0 == channel.camera) {
+            continue;
+        }
+        LiveViewSyncStats stats;
+        stats.camera = channel.camera;
+        stats.buffered = channel.count;
+        stats.received = channel.received;
+        stats.matched = channel.matched;
+        stats.stale = channel.stale;
+        stats.overflow = channel.overflow;
+        stats.invalid_time_code = channel.invalid_time_code;
+        stats.offset_frames = 0 == channel.matched ? 0.0 : channel.offset_sum / channel.matched;
+        stats.skew_us = 0 == channel.matched ? 0.0 : channel.skew_sum / channel.matched;
+        stats.skew_min_us = 0 == channel.matched ? 0 : channel.skew_min;
+        stats.skew_max_us = 0 == channel.matched ? 0 : channel.skew_max;
+
+        double const denominator = channel.n * channel.sxx - channel.sx * channel.sx;
+        stats.drift_ppm = (channel.n < 2 || 0.0 == denominator)
+            ? 0.0
+            : (channel.n * channel.sxy - channel.sx * channel.sy) / denominator * 1e6;
+        result.push_back(stats);
+    }
+    return result;
+}
+
+void LiveViewSync::accept(LiveViewFrame* frame)
+{
+    Channel* channel = channel_of(frame->camera);
+    if (!channel) {
+        LiveViewFramePool::release(frame); // more cameras than a set holds
+        return;
+    }
+    ++channel->received;
+
+    std::int64_t const time_code = time_code_to_frames(frame->time_code, m_config.fps);
+    if (time_code < 0) {
+        ++channel->invalid_time_code;
+        LiveViewFramePool::release(frame);
+        return;
+    }
+    bool const drop_frame = 0 != (frame->time_code & DropFrameFlag);
+    if (drop_frame != m_drop_frame) {
+        m_drop_frame = drop_frame;
+        m_day_frames = time_code_day_frames(m_config.fps, drop_frame);
+    }
+
+    // Drift: how far the time code runs ahead of the host clock since the first frame
+    if (0 == channel->n) {
+        channel->first_host = frame->timestamp;
+        channel->first_time_code = time_code;
+    }
+    double const x = std::chrono::duration<double>(frame->timestamp - channel->first_host).count();
+    double const y = seconds_of(distance(channel->first_time_code, time_code)) - x;
+    channel->n += 1;
+    channel->sx += x;
+    channel->sy += y;
+    channel->sxx += x * x;
+    channel->sxy += x * y;
+
+    if (m_config.max_buffered <= channel->count) {
+        drop_head(*channel);
+        ++channel->overflow;
+    }
+    std::size_t const tail = (channel->head + channel->count) % MaxBuffered;
+    channel->frames[tail] = frame;
+    channel->time_codes[tail] = time_code;
+    ++channel->count;
+}
+
+bool LiveViewSync::match(LiveViewSyncSet& set)
+{
+    std::size_t const cameras = m_mux.size();
+    if (0 == cameras || LiveViewSyncSet::MaxCameras < cameras) {
+        return false;
+    }
+
+    Channel* active[LiveViewSyncSet::MaxCameras];
+    std::size_t count = 0;
+    for (auto& channel : m_channels) {
+        if (0 == channel.camera) {
+            continue;
+        }
+        if (!m_mux.contains(channel.camera)) {
+            clear(channel); // removed from the multiplexer
+            continue;
+        }
+        if (0 == channel.count) {
+            return false; // still waiting for this camera
+        }
+        active[count++] = &channel;
+    }
+    if (count != cameras) {
+        return false; // a camera has not delivered anything yet
+    }
+
+    for (;;) {
+        // Newest head, measured from the first camera so midnight wraps compare correctly
+        std::int64_t const base = active[0]->time_codes[active[0]->head];
+        std::int64_t newest = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            newest = std::max(newest, distance(base, active[i]->time_codes[active[i]->head]));
+        }
+
+        // Heads older than the tolerance cannot match anything still to come
+        bool dropped = false;
+        for (std::size_t i = 0; i < count; ++i) {
+            Channel& channel = *active[i];
+            while (0 < channel.count
+                && static_cast<std::int64_t>(m_config.tolerance) < newest - distance(base, channel.time_codes[channel.head])) {
+                drop_head(channel);
+                ++channel.stale;
+                dropped = true;
+            }
+            if (0 == channel.count) {
+                return false;
+            }
+        }
+        if (dropped) {
+            continue; // a new head may be newer than every other
+        }
+
+        Channel const& first = *active[0];
+        auto const first_host = first.frames[first.head]->timestamp;
+        set.count = count;
+        set.time_code = (base + newest) % m_day_frames;
+        for (std::size_t i = 0; i < count; ++i) {
+            Channel& channel = *active[i];
+            LiveViewFrame* frame = channel.frames[channel.head];
+            auto const skew = std::chrono::duration_cast<std::chrono::microseconds>(frame->timestamp - first_host).count();
+            channel.offset_sum += static_cast<double>(distance(base, channel.time_codes[channel.head]));
+            channel.skew_sum += static_cast<double>(skew);
+            channel.skew_min = (0 == channel.matched) ? skew : std::min<std::int64_t>(channel.skew_min, skew);
+            channel.skew_max = (0 == channel.matched) ? skew : std::max<std::int64_t>(channel.skew_max, skew);
+            ++channel.matched;
+
+            set.frames[i] = frame;
+            channel.frames[channel.head] = nullptr;
+            channel.head = (channel.head + 1) % MaxBuffered;
+            --channel.count;
+        }
+        ++m_sets;
+        return true;
+    }
+}
+
+LiveViewSync::Channel* LiveViewSync::channel_of(std::int32_t camera)
+{
+    Channel* unused = nullptr;
+    for (auto& channel : m_channels) {
+        if (channel.camera == camera) {
+            return &channel;
+        }
+        if (!unused && 0 == channel.camera) {
+            unused = &channel;
+        }
+    }
+    if (unused) {
+        clear(*unused);
+        unused->camera = camera;
+    }
+    return unused;
+}
+
+void LiveViewSync::drop_head(Channel& channel)
+{
+    LiveViewFramePool::release(channel.frames[channel.head]);
+    channel.frames[channel.head] = nullptr;
+    channel.head = (channel.head + 1) % MaxBuffered;
+    --channel.count;
+}
+
+void LiveViewSync::clear(Channel& channel)
+{
+    while (0 < channel.count) {
+        drop_head(channel);
+    }
+    for (auto& frame : channel.frames) {
+        frame = nullptr;
+    }
+    channel.head = 0;
+    channel.received = 0;
+    channel.matched = 0;
+    channel.stale = 0;
+    channel.overflow = 0;
+    channel.invalid_time_code = 0;
+    channel.offset_sum = 0.0;
+    channel.skew_sum = 0.0;
+    channel.skew_min = 0;
+    channel.skew_max = 0;
+    channel.first_host = std::chrono::steady_clock::time_point();
+    channel.first_time_code = 0;
+    channel.n = channel.sx = channel.sy = channel.sxx = channel.sxy = 0.0;
+}
+
+// Signed frames from one time code to another, taking the shorter way around midnight
+std::int64_t LiveViewSync::distance(std::int64_t from, std::int64_t to) const
+{
+    std::int64_t d = (to - from) % m_day_frames;
+    if (d < 0) d += m_day_frames;
+    if (m_day_frames / 2 < d) d -= m_day_frames;
+    return d;
+}
+
+double LiveViewSync::seconds_of(std::int64_t frames) const
+{
+    // Drop-frame time code counts frames at fps * 1000 / 1001
+    double const rate = m_drop_frame ? m_config.fps * 1000.0 / 1001.0 : static_cast<double>(m_config.fps);
+    return frames / rate;
+}
+
+} // namespace cli
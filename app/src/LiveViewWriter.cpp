@@ -0,0 +1,427 @@
+#include "LiveViewWriter.h"
+#include <cerrno>
+#include <cstdio>
+#if defined(__GNUC__) && __GNUC__ < 8
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#include <filesystem>
+namespace fs = std::filesystem;
+#endif
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <io.h>
+#include <fcntl.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Upper bound of frames gathered into one write call
+constexpr std::size_t const MaxBatch = 64;
+// Container records take a header, the payload and the padding
+constexpr std::size_t const MaxChunks = 3 * MaxBatch;
+
+int open_file(fs::path const& path, bool append)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    int fd = -1;
+    int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (append ? _O_APPEND : _O_TRUNC);
+    _wsopen_s(&fd, path.c_str(), flags, _SH_DENYWR, _S_IREAD | _S_IWRITE);
+    return fd;
+#else
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+    return ::open(path.c_str(), flags, 0644);
+#endif
+}
+
+void close_file(int fd)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+bool sync_file(int fd)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return 0 == _commit(fd);
+#else
+    return 0 == ::fsync(fd);
+#endif
+}
+
+// Cut the file to size bytes and continue writing there
+bool truncate_file(int fd, std::uint64_t size)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return 0 == _chsize_s(fd, static_cast<__int64>(size)) && 0 <= _lseeki64(fd, static_cast<__int64>(size), SEEK_SET);
+#else
+    return 0 == ::ftruncate(fd, static_cast<off_t>(size)) && 0 <= ::lseek(fd, static_cast<off_t>(size), SEEK_SET);
+#endif
+}
+
+struct Chunk
+{
+    void const* data;
+    std::size_t size;
+};
+
+// Gathered write of all chunks, retried until everything is out
+bool write_chunks(int fd, Chunk const* chunks, std::size_t count)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const* data = static_cast<char const*>(chunks[i].data);
+        auto remaining = static_cast<unsigned int>(chunks[i].size);
+        while (0 < remaining) {
+            int written = _write(fd, data, remaining);
+            if (written <= 0) return false;
+            data += written;
+            remaining -= written;
+        }
+    }
+    return true;
+#else
+    struct iovec iov[MaxChunks];
+    std::size_t niov = 0;
+    for (std::size_t i = 0; i < count && niov < MaxChunks; ++i) {
+        if (0 == chunks[i].size) continue;
+        iov[niov].iov_base = const_cast<void*>(chunks[i].data);
+        iov[niov].iov_len = chunks[i].size;
+        ++niov;
+    }
+
+    struct iovec* cur = iov;
+    while (0 < niov) {
+        ssize_t written = ::writev(fd, cur, static_cast<int>(niov));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        // Skip what went out, a partial write can end inside a chunk
+        while (0 < niov && static_cast<std::size_t>(written) >= cur->iov_len) {
+            written -= cur->iov_len;
+            ++cur;
+            --niov;
+        }
+        if (0 < niov) {
+            cur->iov_base = static_cast<char*>(cur->iov_base) + written;
+            cur->iov_len -= written;
+        }
+    }
+    return true;
+#endif
+}
+
+// Payload of every frame back-to-back
+bool write_frames(int fd, cli::LiveViewFrame* const* frames, std::size_t count)
+{
+    Chunk chunks[MaxBatch];
+    for (std::size_t i = 0; i < count; ++i) {
+        chunks[i] = Chunk{ frames[i]->data, frames[i]->size };
+    }
+    return write_chunks(fd, chunks, count);
+}
+} // namespace
+
+namespace cli
+{
+LiveViewWriter::LiveViewWriter()
+    : m_stream(nullptr)
+    , m_config()
+    , m_ring()
+    , m_thread()
+    , m_running(false)
+    , m_fd(-1)
+    , m_file_no(0)
+    , m_offset(0)
+    , m_start_time()
+    , m_index()
+    , m_last_sync()
+    , m_frames_written(0)
+    , m_bytes_written(0)
+    , m_batches(0)
+    , m_syncs(0)
+    , m_write_errors(0)
+    , m_failed(false)
+    , m_dropped_before(0)
+    , m_write_age()
+{
+}
+
+LiveViewWriter::~LiveViewWriter()
+{
+    stop();
+}
+
+bool LiveViewWriter::start(LiveViewStream& stream, LiveViewWriterConfig const& config)
+{
+    if (is_running()) {
+        return false;
+    }
+    stop(); // a writer which gave up after a write error
+    m_failed.store(false, std::memory_order_relaxed);
+
+    m_config = config;
+    if (m_config.max_batch < 1) m_config.max_batch = 1;
+    if (MaxBatch < m_config.max_batch) m_config.max_batch = MaxBatch;
+
+    fs::path path(m_config.path);
+    if (LiveViewWriteMode::AppendFile == m_config.mode) {
+        m_fd = open_file(path, true);
+        if (m_fd < 0) {
+            return false;
+        }
+    }
+    else if (LiveViewWriteMode::Container == m_config.mode) {
+        m_fd = open_file(path, false);
+        if (m_fd < 0) {
+            return false;
+        }
+        lvc::FileHeader header = {};
+        header.magic = lvc::FileMagic;
+        header.version = lvc::Version;
+        header.header_size = sizeof(header);
+        header.system_start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        Chunk chunk{ &header, sizeof(header) };
+        if (!write_chunks(m_fd, &chunk, 1)) {
+            close_file(m_fd);
+            m_fd = -1;
+            return false;
+        }
+        m_offset = sizeof(header);
+        m_start_time = std::chrono::steady_clock::now();
+        m_index.clear();
+    }
+    else {
+        std::error_code ec;
+        fs::create_directories(path, ec);
+        if (!fs::is_directory(path, ec)) {
+            return false;
+        }
+        m_file_no = 0;
+    }
+
+    m_stream = &stream;
+    // A whole batch stays popped while it is written
+    m_ring = stream.subscribe(m_config.ring_capacity, m_config.max_batch);
+    m_last_sync = std::chrono::steady_clock::now();
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&LiveViewWriter::run, this);
+    return true;
+}
+
+void LiveViewWriter::stop()
+{
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    if (m_ring) {
+        m_stream->unsubscribe(m_ring);
+        m_dropped_before += m_ring->dropped();
+        m_ring.reset();
+    }
+    finish_file();
+}
+
+void LiveViewWriter::finish_file()
+{
+    if (0 <= m_fd) {
+        if (LiveViewWriteMode::Container == m_config.mode && !write_container_index()) {
+            m_write_errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (LiveViewSyncPolicy::None != m_config.sync && sync_file(m_fd)) {
+            m_syncs.fetch_add(1, std::memory_order_relaxed);
+        }
+        close_file(m_fd);
+        m_fd = -1;
+    }
+}
+
+std::uint64_t LiveViewWriter::dropped() const
+{
+    return m_dropped_before + (m_ring ? m_ring->dropped() : 0);
+}
+
+void LiveViewWriter::run()
+{
+    LiveViewFrame* batch[MaxBatch];
+    for (;;) {
+        bool const running = m_running.load(std::memory_order_acquire);
+        LiveViewFrame* frame = running ? m_ring->pop_wait(50ms) : m_ring->pop();
+        if (!frame) {
+            if (!running) break; // drained
+            if (0 <= m_fd && sync_due(false)) {
+                // Idle, catch up on an interval sync
+                if (sync_file(m_fd)) m_syncs.fetch_add(1, std::memory_order_relaxed);
+            }
+            continue;
+        }
+
+        // Coalesce everything that queued up while the last batch was written
+        std::size_t count = 0;
+        batch[count++] = frame;
+        while (count < m_config.max_batch && (frame = m_ring->pop())) {
+            batch[count++] = frame;
+        }
+
+        bool const written = write_batch(batch, count);
+        for (std::size_t i = 0; i < count; ++i) {
+            LiveViewFramePool::release(batch[i]);
+        }
+        if (!written) {
+            m_write_errors.fetch_add(1, std::memory_order_relaxed);
+            if (LiveViewWriteMode::NumberedFiles != m_config.mode) {
+                // A file which failed once takes no more frames: close it with what it holds and stop
+                m_failed.store(true, std::memory_order_relaxed);
+                m_running.store(false, std::memory_order_release);
+                m_stream->unsubscribe(m_ring);
+                finish_file();
+                break;
+            }
+        }
+    }
+}
+
+bool LiveViewWriter::write_batch(LiveViewFrame** frames, std::size_t count)
+{
+    bool result = true;
+    if (LiveViewWriteMode::NumberedFiles != m_config.mode) {
+        result = LiveViewWriteMode::Container == m_config.mode
+            ? write_container(frames, count)
+            : write_frames(m_fd, frames, count);
+        if (result && sync_due(true)) {
+            if (sync_file(m_fd)) m_syncs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    else {
+        for (std::size_t i = 0; i < count; ++i) {
+            result = write_numbered(frames[i]) && result;
+        }
+    }
+
+    if (result) {
+        auto const now = std::chrono::steady_clock::now();
+        std::uint64_t bytes = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            bytes += frames[i]->size;
+            m_write_age.record(std::chrono::duration_cast<std::chrono::microseconds>(now - frames[i]->timestamp).count());
+        }
+        m_frames_written.fetch_add(count, std::memory_order_relaxed);
+        m_bytes_written.fetch_add(bytes, std::memory_order_relaxed);
+    }
+    m_batches.fetch_add(1, std::memory_order_relaxed);
+    return result;
+}
+
+bool LiveViewWriter::write_numbered(LiveViewFrame* frame)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "LiveView%06u.JPG", m_file_no++);
+    fs::path path(m_config.path);
+    path /= name;
+
+    int fd = open_file(path, false);
+    if (fd < 0) {
+        return false;
+    }
+    bool result = write_frames(fd, &frame, 1);
+    if (result && sync_due(true)) {
+        // Each file carries its own data, so it is synced before it is closed
+        if (sync_file(fd)) m_syncs.fetch_add(1, std::memory_order_relaxed);
+    }
+    close_file(fd);
+    return result;
+}
+
+bool LiveViewWriter::write_container(LiveViewFrame** frames, std::size_t count)
+{
+    static CrInt8u const zeros[lvc::Alignment] = {};
+    lvc::RecordHeader headers[MaxBatch];
+    Chunk chunks[MaxChunks];
+    std::size_t nchunks = 0;
+    std::uint64_t offset = m_offset;
+    std::size_t const first = m_index.size();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const* frame = frames[i];
+        auto& header = headers[i];
+        header.magic = lvc::RecordMagic;
+        header.size = frame->size;
+        header.frame_no = frame->frame_no;
+        header.time_code = frame->time_code;
+        header.host_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(frame->timestamp - m_start_time).count();
+
+        std::size_t const padding = lvc::padding(frame->size);
+        chunks[nchunks++] = Chunk{ &header, sizeof(header) };
+        chunks[nchunks++] = Chunk{ frame->data, frame->size };
+        chunks[nchunks++] = Chunk{ zeros, padding };
+
+        m_index.push_back(lvc::IndexEntry{ offset, header.frame_no, header.time_code, header.host_time_ns });
+        offset += sizeof(header) + frame->size + padding;
+    }
+
+    if (!write_chunks(m_fd, chunks, nchunks)) {
+        // Cut off the partial batch, so the index can follow the last complete record
+        m_index.resize(first);
+        if (!truncate_file(m_fd, m_offset)) {
+            close_file(m_fd);
+            m_fd = -1;
+        }
+        return false;
+    }
+    m_offset = offset;
+    return true;
+}
+
+bool LiveViewWriter::write_container_index()
+{
+    lvc::Footer footer = {};
+    footer.index_offset = m_offset;
+    footer.count = m_index.size();
+    footer.magic = lvc::IndexMagic;
+    footer.version = lvc::Version;
+
+    Chunk chunks[] = {
+        { m_index.data(), m_index.size() * sizeof(lvc::IndexEntry) },
+        { &footer, sizeof(footer) },
+    };
+    bool result = write_chunks(m_fd, chunks, 2);
+    m_index.clear();
+    m_index.shrink_to_fit();
+    return result;
+}
+
+bool LiveViewWriter::sync_due(bool batch_end)
+{
+    switch (m_config.sync) {
+    case LiveViewSyncPolicy::EveryBatch:
+        return batch_end;
+    case LiveViewSyncPolicy::Interval:
+    {
+        auto const now = std::chrono::steady_clock::now();
+        if (now - m_last_sync < m_config.sync_interval) {
+            return false;
+        }
+        m_last_sync = now;
+        return true;
+    }
+    case LiveViewSyncPolicy::None:
+    default:
+        return false;
+    }
+}
+
+} // namespace cli
@@ -0,0 +1,82 @@
+#include "PropertyBatch.h"
+#include <algorithm>
+#include "CrDeviceProperty.h"
+
+namespace SDK = SCRSDK;
+
+namespace cli
+{
+
+namespace
+{
+
+struct PropertyStage
+{
+    CrInt32u code;
+    int stage;
+};
+
+// Properties others depend on; anything else is applied in DefaultStage
+constexpr PropertyStage Stages[] = {
+    // Who controls the camera decides whether the rest can be set remotely
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings, 0 },
+    // Modes, which decide what is writable and which values are possible
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureProgramMode, 1 },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusMode, 1 },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_DriveMode, 1 },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalance, 1 },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FileType, 1 },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Movie_Recording_Setting, 1 },
+};
+
+constexpr int DefaultStage = 2;
+
+} // namespace
+
+int property_stage(CrInt32u code)
+{
+    for (auto const& entry : Stages) {
+        if (entry.code == code) {
+            return entry.stage;
+        }
+    }
+    return DefaultStage;
+}
+
+void order_assignments(std::vector<PropertyAssignment>& batch)
+{
+    // Later assignments of a code win
+    for (std::size_t i = batch.size(); 0 < i--;) {
+        auto const code = batch[i].code;
+        auto const first = std::find_if(batch.begin(), batch.begin() + i,
+            [code](PropertyAssignment const& assignment) { return assignment.code == code; });
+        if (batch.begin() + i != first) {
+            batch.erase(first);
+        }
+    }
+    std::stable_sort(batch.begin(), batch.end(), [](PropertyAssignment const& a, PropertyAssignment const& b) {
+        return property_stage(a.code) < property_stage(b.code);
+    });
+}
+
+char const* format_assignment_result(PropertyAssignmentResult result)
+{
+    switch (result) {
+    case PropertyAssignmentResult::Pending:
+        return "Pending";
+    case PropertyAssignmentResult::Confirmed:
+        return "Confirmed";
+    case PropertyAssignmentResult::Unsupported:
+        return "Unsupported";
+    case PropertyAssignmentResult::NotWritable:
+        return "Not writable";
+    case PropertyAssignmentResult::Rejected:
+        return "Rejected";
+    case PropertyAssignmentResult::TimedOut:
+        return "Timed out";
+    default:
+        return "Unknown";
+    }
+}
+
+} // namespace cli
@@ -0,0 +1,83 @@
+#include "PropertyChangeQueue.h"
+#include <algorithm>
+
+namespace cli
+{
+PropertyChangeQueue::PropertyChangeQueue()
+    : m_mtx()
+    , m_pushed()
+    , m_pending()
+    , m_generation(0)
+    , m_invalid(true)
+    , m_dirty(true)
+{
+    m_pending.reserve(MaxPending);
+}
+
+void PropertyChangeQueue::push(CrInt32u num, CrInt32u const* codes)
+{
+    if (0 == num || !codes) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (!m_invalid) {
+        for (CrInt32u i = 0; i < num; ++i) {
+            if (m_pending.end() == std::find(m_pending.begin(), m_pending.end(), codes[i])) {
+                if (MaxPending <= m_pending.size()) {
+                    m_invalid = true;
+                    m_pending.clear();
+                    break;
+                }
+                m_pending.push_back(codes[i]);
+            }
+        }
+    }
+    m_dirty.store(true, std::memory_order_release);
+    m_generation.fetch_add(1, std::memory_order_release);
+    m_pushed.notify_all();
+}
+
+bool PropertyChangeQueue::wait_push(std::uint64_t generation, std::chrono::steady_clock::time_point deadline)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    return m_pushed.wait_until(lock, deadline, [&] {
+        return generation != m_generation.load(std::memory_order_relaxed);
+    });
+}
+
+void PropertyChangeQueue::invalidate()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_invalid = true;
+    m_pending.clear();
+    m_dirty.store(true, std::memory_order_release);
+}
+
+PropertyChangeQueue::Refresh PropertyChangeQueue::take(std::vector<CrInt32u>& codes)
+{
+    codes.clear();
+    if (!m_dirty.load(std::memory_order_acquire)) {
+        return Refresh::None;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_dirty.store(false, std::memory_order_relaxed);
+    if (m_invalid) {
+        m_invalid = false;
+        m_pending.clear();
+        return Refresh::All;
+    }
+    if (m_pending.empty()) {
+        return Refresh::None;
+    }
+    codes.swap(m_pending);
+    // The callback thread must never grow m_pending. After the first swaps the two buffers
+    // ping-pong at full capacity and this does not allocate any more.
+    if (m_pending.capacity() < MaxPending) {
+        m_pending.reserve(MaxPending);
+    }
+    std::sort(codes.begin(), codes.end());
+    return Refresh::Codes;
+}
+
+} // namespace cli
@@ -0,0 +1,231 @@
+#include "PropertyDecoder.h"
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace SDK = SCRSDK;
+
+namespace cli
+{
+namespace
+{
+using Decoder = void (*)(PropertyValueTable&, SDK::CrDeviceProperty&);
+
+template <typename Member>
+struct entry_of;
+
+template <typename T>
+struct entry_of<PropertyValueEntry<T> PropertyValueTable::*>
+{
+    using value_type = T;
+};
+
+template <auto Member>
+using value_type_of = typename entry_of<decltype(Member)>::value_type;
+
+// Writable and current value only
+template <auto Member>
+void decode_current(PropertyValueTable& table, SDK::CrDeviceProperty& prop)
+{
+    auto& entry = table.*Member;
+    entry.writable = prop.IsSetEnableCurrentValue();
+    entry.current = static_cast<value_type_of<Member>>(prop.GetCurrentValue());
+}
+
+// Writable, current value and the possible values when the camera sends any
+template <auto Member, auto Parse>
+void decode_values(PropertyValueTable& table, SDK::CrDeviceProperty& prop)
+{
+    using T = value_type_of<Member>;
+    auto& entry = table.*Member;
+    std::uint32_t const nval = prop.GetValueSize() / sizeof(T);
+    entry.writable = prop.IsSetEnableCurrentValue();
+    entry.current = static_cast<T>(prop.GetCurrentValue());
+    if (0 < nval) {
+        Parse(prop.GetValues(), nval, entry.possible);
+    }
+}
+
+// As decode_values(), the possible values are parsed again only when their number changed
+template <auto Member, auto Parse>
+void decode_values_resized(PropertyValueTable& table, SDK::CrDeviceProperty& prop)
+{
+    using T = value_type_of<Member>;
+    auto& entry = table.*Member;
+    std::uint32_t const nval = prop.GetValueSize() / sizeof(T);
+    entry.writable = prop.IsSetEnableCurrentValue();
+    entry.current = static_cast<T>(prop.GetCurrentValue());
+    if (nval != entry.possible.size()) {
+        Parse(prop.GetValues(), nval, entry.possible);
+    }
+}
+
+// Writable and possible values, the current value is not used
+template <auto Member, auto Parse>
+void decode_possible(PropertyValueTable& table, SDK::CrDeviceProperty& prop)
+{
+    using T = value_type_of<Member>;
+    auto& entry = table.*Member;
+    std::uint32_t const nval = prop.GetValueSize() / sizeof(T);
+    entry.writable = prop.IsSetEnableCurrentValue();
+    if (0 < nval) {
+        Parse(prop.GetValues(), nval, entry.possible);
+    }
+}
+
+void decode_lens_model_name(PropertyValueTable& table, SDK::CrDeviceProperty& prop)
+{
+    auto& entry = table.lensModelNameStr;
+    entry.writable = prop.IsSetEnableCurrentValue();
+    CrInt16u* pCurrentStr = prop.GetCurrentStr();
+    if (pCurrentStr)
+    {
+        entry.length = (int)*pCurrentStr;
+#if defined(WIN32) || defined(_WIN64)//#if defined(_UNICODE) || defined(UNICODE)
+        entry.current = text((CrChar*)&pCurrentStr[1]);
+#else
+        char buff[128];
+        memset(buff, 0, sizeof(buff));
+        pCurrentStr++;
+        for (int i = 0; i < (entry.length - 1) && i < static_cast<int>(sizeof(buff)) - 1; ++i, pCurrentStr++)
+        {
+            wctomb(&buff[i], (wchar_t)*pCurrentStr);
+        }
+        if (0 < strlen(buff))
+        {
+            entry.current = text((CrChar*)buff);
+        }
+#endif
+    }
+}
+
+struct DecoderEntry
+{
+    CrInt32u code;
+    Decoder decode;
+};
+
+constexpr DecoderEntry const Decoders[] = {
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_SdkControlMode, &decode_current<&PropertyValueTable::sdk_mode> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FNumber, &decode_values<&PropertyValueTable::f_number, parse_f_number> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_IsoSensitivity, &decode_values<&PropertyValueTable::iso_sensitivity, parse_iso_sensitivity> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterSpeed, &decode_values<&PropertyValueTable::shutter_speed, parse_shutter_speed> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_PriorityKeySettings, &decode_values_resized<&PropertyValueTable::position_key_setting, parse_position_key_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureProgramMode, &decode_values<&PropertyValueTable::exposure_program_mode, parse_exposure_program_mode> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_DriveMode, &decode_values<&PropertyValueTable::still_capture_mode, parse_still_capture_mode> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusMode, &decode_values<&PropertyValueTable::focus_mode, parse_focus_mode> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusArea, &decode_values<&PropertyValueTable::focus_area, parse_focus_area> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_LiveView_Image_Quality, &decode_values<&PropertyValueTable::live_view_image_quality, parse_live_view_image_quality> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_FormatEnableStatus, &decode_values_resized<&PropertyValueTable::media_slot1_full_format_enable_status, parse_media_slotx_format_enable_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_FormatEnableStatus, &decode_values_resized<&PropertyValueTable::media_slot2_full_format_enable_status, parse_media_slotx_format_enable_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_QuickFormatEnableStatus, &decode_values_resized<&PropertyValueTable::media_slot1_quick_format_enable_status, parse_media_slotx_format_enable_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_QuickFormatEnableStatus, &decode_values_resized<&PropertyValueTable::media_slot2_quick_format_enable_status, parse_media_slotx_format_enable_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalance, &decode_values<&PropertyValueTable::white_balance, parse_white_balance> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Standby, &decode_values_resized<&PropertyValueTable::customwb_capture_standby, parse_customwb_capture_standby> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Standby_Cancel, &decode_values_resized<&PropertyValueTable::customwb_capture_standby_cancel, parse_customwb_capture_standby_cancel> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Capture_Operation, &decode_values<&PropertyValueTable::customwb_capture_operation, parse_customwb_capture_operation> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CustomWB_Execution_State, &decode_values_resized<&PropertyValueTable::customwb_capture_execution_state, parse_customwb_capture_execution_state> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Operation_Status, &decode_values_resized<&PropertyValueTable::zoom_operation_status, parse_zoom_operation_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Setting, &decode_values<&PropertyValueTable::zoom_setting_type, parse_zoom_setting_type> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Type_Status, &decode_values_resized<&PropertyValueTable::zoom_types_status, parse_zoom_types_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Zoom_Speed_Range, &decode_possible<&PropertyValueTable::zoom_speed_range, parse_zoom_speed_range> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ZoomAndFocusPosition_Save, &decode_possible<&PropertyValueTable::save_zoom_and_focus_position, parse_save_zoom_and_focus_position> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ZoomAndFocusPosition_Load, &decode_possible<&PropertyValueTable::load_zoom_and_focus_position, parse_load_zoom_and_focus_position> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Remocon_Zoom_Speed_Type, &decode_values<&PropertyValueTable::remocon_zoom_speed_type, parse_remocon_zoom_speed_type> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_APS_C_or_Full_SwitchingSetting, &decode_current<&PropertyValueTable::aps_c_of_full_switching_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_APS_C_or_Full_SwitchingEnableStatus, &decode_current<&PropertyValueTable::aps_c_of_full_switching_enable_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSetting_SaveOperationEnableStatus, &decode_current<&PropertyValueTable::camera_setting_save_operation> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSetting_ReadOperationEnableStatus, &decode_current<&PropertyValueTable::camera_setting_read_operation> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSetting_SaveRead_State, &decode_current<&PropertyValueTable::camera_setting_save_read_state> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_CameraSettingsResetEnableStatus, &decode_current<&PropertyValueTable::camera_setting_reset_enable_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_PlaybackMedia, &decode_values<&PropertyValueTable::playback_media, parse_playback_media> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_GainBaseSensitivity, &decode_values<&PropertyValueTable::gain_base_sensitivity, parse_gain_base_sensitivity> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_GainBaseIsoSensitivity, &decode_values<&PropertyValueTable::gain_base_iso_sensitivity, parse_gain_base_iso_sensitivity> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MonitorLUTSetting, &decode_values<&PropertyValueTable::monitor_lut_setting, parse_monitor_lut_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureIndex, &decode_values<&PropertyValueTable::exposure_index, parse_exposure_index> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_BaseLookValue, &decode_values<&PropertyValueTable::baselook_value, parse_baselook_value> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_IrisModeSetting, &decode_values<&PropertyValueTable::iris_mode_setting, parse_iris_mode_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterModeSetting, &decode_values<&PropertyValueTable::shutter_mode_setting, parse_shutter_mode_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_GainControlSetting, &decode_values<&PropertyValueTable::gain_control_setting, parse_gain_control_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ExposureCtrlType, &decode_values<&PropertyValueTable::exposure_control_type, parse_exposure_control_type> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_IsoCurrentSensitivity, &decode_current<&PropertyValueTable::iso_current_sensitivity> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Movie_Recording_Setting, &decode_values<&PropertyValueTable::recording_setting, parse_recording_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_DispModeCandidate, &decode_values<&PropertyValueTable::dispmode_candidate, parse_dispmode_candidate> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_DispModeSetting, &decode_values<&PropertyValueTable::dispmode_setting, parse_dispmode_setting> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_DispMode, &decode_values<&PropertyValueTable::dispmode, parse_dispmode> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_GaindBValue, &decode_values<&PropertyValueTable::gain_db_value, parse_gain_db_value> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalanceTint, &decode_values<&PropertyValueTable::white_balance_tint, parse_white_balance_tint> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_WhiteBalanceTintStep, &decode_values<&PropertyValueTable::white_balance_tint_step, parse_white_balance_tint_step> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MovieRecButtonToggleEnableStatus, &decode_current<&PropertyValueTable::movie_rec_button_toggle_enable_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterSpeedValue, &decode_values<&PropertyValueTable::shutter_speed_value, parse_shutter_speed_value> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_Status, &decode_current<&PropertyValueTable::media_slot1_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_Status, &decode_current<&PropertyValueTable::media_slot2_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT3_Status, &decode_current<&PropertyValueTable::media_slot3_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusBracketShotNumber, &decode_values<&PropertyValueTable::focus_bracket_shot_num, parse_focus_bracket_shot_num> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusBracketFocusRange, &decode_values<&PropertyValueTable::focus_bracket_focus_range, parse_focus_bracket_focus_range> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_Movie_ImageStabilizationSteadyShot, &decode_values<&PropertyValueTable::movie_image_stabilization_steady_shot, parse_movie_image_stabilization_steady_shot> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ImageStabilizationSteadyShot, &decode_values<&PropertyValueTable::image_stabilization_steady_shot, parse_image_stabilization_steady_shot> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_SilentMode, &decode_values<&PropertyValueTable::silent_mode, parse_silent_mode> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeApertureDriveInAF, &decode_values<&PropertyValueTable::silent_mode_aperture_drive_in_af, parse_silent_mode_aperture_drive_in_af> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeShutterWhenPowerOff, &decode_values<&PropertyValueTable::silent_mode_shutter_when_power_off, parse_silent_mode_shutter_when_power_off> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_SilentModeAutoPixelMapping, &decode_values<&PropertyValueTable::silent_mode_auto_pixel_mapping, parse_silent_mode_auto_pixel_mapping> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ShutterType, &decode_values<&PropertyValueTable::shutter_type, parse_shutter_type> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MovieShootingMode, &decode_values<&PropertyValueTable::movie_shooting_mode, parse_movie_shooting_mode> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusPositionSetting, &decode_values<&PropertyValueTable::focus_position_setting, parse_focus_position> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusPositionCurrentValue, &decode_values<&PropertyValueTable::focus_position_current_value, parse_focus_position> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_FocusDrivingStatus, &decode_values<&PropertyValueTable::focus_driving_status, parse_focus_driving_status> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_ZoomDistance, &decode_values<&PropertyValueTable::zoom_distance, parse_zoom_distance> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_LensModelName, &decode_lens_model_name },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT1_RecordingAvailableType, &decode_values<&PropertyValueTable::media_slot1_recording_available_type, parse_slotx_rec_available> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT2_RecordingAvailableType, &decode_values<&PropertyValueTable::media_slot2_recording_available_type, parse_slotx_rec_available> },
+    { SDK::CrDevicePropertyCode::CrDeviceProperty_MediaSLOT3_RecordingAvailableType, &decode_values<&PropertyValueTable::media_slot3_recording_available_type, parse_slotx_rec_available> },
+};
+
+constexpr std::size_t const DecoderCount = sizeof(Decoders) / sizeof(Decoders[0]);
+// Every device property code is below CrDeviceProperty_MaxVal, so one byte per code indexes the table
+constexpr std::size_t const CodeCount = SDK::CrDevicePropertyCode::CrDeviceProperty_MaxVal;
+static_assert(DecoderCount < 0xFF, "decoder index is one byte");
+
+constexpr bool valid_decoders()
+{
+    std::array<bool, CodeCount> seen{};
+    for (std::size_t i = 0; i < DecoderCount; ++i) {
+        if (CodeCount <= Decoders[i].code || seen[Decoders[i].code]) {
+            return false;
+        }
+        seen[Decoders[i].code] = true;
+    }
+    return true;
+}
+static_assert(valid_decoders(), "property code out of range or listed twice");
+
+// Code to 1 + position in Decoders, 0: no decoder
+constexpr std::array<std::uint8_t, CodeCount> make_decoder_index()
+{
+    std::array<std::uint8_t, CodeCount> index{};
+    for (std::size_t i = 0; i < DecoderCount; ++i) {
+        index[Decoders[i].code] = static_cast<std::uint8_t>(i + 1);
+    }
+    return index;
+}
+
+constexpr std::array<std::uint8_t, CodeCount> const DecoderIndex = make_decoder_index();
+} // namespace
+
+bool decode_property(PropertyValueTable& table, SDK::CrDeviceProperty& prop)
+{
+    CrInt32u const code = prop.GetCode();
+    if (CodeCount <= code || 0 == DecoderIndex[code]) {
+        return false;
+    }
+    Decoders[DecoderIndex[code] - 1].decode(table, prop);
+    return true;
+}
+
+std::size_t decoded_property_count()
+{
+    return DecoderCount;
+}
+
+} // namespace cli
@@ -0,0 +1,125 @@
+#include "PropertyHistory.h"
+
+namespace SDK = SCRSDK;
+
+namespace cli
+{
+
+PropertyHistory::PropertyHistory()
+    : m_mtx()
+    , m_ring()
+    , m_recorded(0)
+    , m_writes()
+{
+    for (auto& reported : m_reported) {
+        reported.store(0, std::memory_order_relaxed);
+    }
+}
+
+void PropertyHistory::reported(CrInt32u num, CrInt32u const* codes)
+{
+    ticks const now = std::chrono::steady_clock::now().time_since_epoch().count();
+    for (CrInt32u i = 0; i < num; ++i) {
+        if (codes[i] < SDK::CrDeviceProperty_MaxVal) {
+            // Keep the first report, the value may change several times before it is loaded
+            ticks none = 0;
+            m_reported[codes[i]].compare_exchange_strong(none, now, std::memory_order_relaxed);
+        }
+    }
+}
+
+void PropertyHistory::wrote(CrInt32u code)
+{
+    auto const now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mtx);
+    Write* slot = nullptr;
+    for (auto& write : m_writes) {
+        if (code == write.code) {
+            slot = &write;
+            break;
+        }
+    }
+    if (!slot) {
+        // A free slot, or the oldest write
+        slot = &m_writes[0];
+        for (auto& write : m_writes) {
+            if (AnyCode == write.code) {
+                slot = &write;
+                break;
+            }
+            if (write.time < slot->time) {
+                slot = &write;
+            }
+        }
+    }
+    slot->code = code;
+    slot->time = now;
+}
+
+void PropertyHistory::write_failed(CrInt32u code)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto& write : m_writes) {
+        if (code == write.code) {
+            write.code = AnyCode;
+        }
+    }
+}
+
+void PropertyHistory::loaded(CrInt32u code, bool known, CrInt64u old_value, CrInt64u new_value)
+{
+    ticks const reported = (code < SDK::CrDeviceProperty_MaxVal)
+        ? m_reported[code].exchange(0, std::memory_order_relaxed) : 0;
+    if (!known || old_value == new_value) {
+        return;
+    }
+
+    PropertyChange change;
+    change.time = (0 != reported)
+        ? std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(reported))
+        : std::chrono::steady_clock::now();
+    change.old_value = old_value;
+    change.new_value = new_value;
+    change.code = code;
+    change.own = false;
+    change.apply_us = -1;
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto& write : m_writes) {
+        if (code != write.code) {
+            continue;
+        }
+        // The first change after a write answers it
+        write.code = AnyCode;
+        if (change.time - write.time <= WriteWindow) {
+            change.own = true;
+            change.apply_us = (write.time < change.time)
+                ? std::chrono::duration_cast<std::chrono::microseconds>(change.time - write.time).count() : 0;
+        }
+        break;
+    }
+    m_ring[m_recorded % Capacity] = change;
+    ++m_recorded;
+}
+
+std::size_t PropertyHistory::recent(PropertyChange* out, std::size_t max, CrInt32u code) const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::uint64_t const oldest = (Capacity < m_recorded) ? m_recorded - Capacity : 0;
+    std::size_t count = 0;
+    for (std::uint64_t i = m_recorded; oldest < i && count < max; --i) {
+        auto const& change = m_ring[(i - 1) % Capacity];
+        if (AnyCode == code || code == change.code) {
+            out[count++] = change;
+        }
+    }
+    return count;
+}
+
+std::uint64_t PropertyHistory::recorded() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_recorded;
+}
+
+} // namespace cli
@@ -0,0 +1,226 @@
+#include "PropertyRegistry.h"
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+namespace SDK = SCRSDK;
+
+namespace
+{
+// Codes above the dense index would need a 128 KiB index; no device property comes close
+constexpr CrInt32u const MaxCode = 0xFFFF;
+// Do not bother compacting small pools
+constexpr std::size_t const MinCompactSize = 4096;
+} // namespace
+
+namespace cli
+{
+PropertyRegistry::PropertyRegistry()
+    : m_index(SDK::CrDevicePropertyCode::CrDeviceProperty_MaxVal, static_cast<CrInt16u>(NoRecord))
+    , m_records()
+    , m_pool()
+    , m_stale(0)
+{
+}
+
+void PropertyRegistry::clear()
+{
+    for (auto const& record : m_records) {
+        m_index[record.code] = static_cast<CrInt16u>(NoRecord);
+    }
+    m_records.clear();
+    m_pool.clear();
+    m_stale = 0;
+}
+
+void PropertyRegistry::update(SDK::CrDeviceProperty& prop)
+{
+    CrInt32u const code = prop.GetCode();
+    if (MaxCode < code) {
+        return;
+    }
+    if (m_index.size() <= code) {
+        m_index.resize(static_cast<std::size_t>(code) + 1, static_cast<CrInt16u>(NoRecord));
+    }
+
+    CrInt32u position = m_index[code];
+    if (NoRecord == position) {
+        if (NoRecord <= m_records.size()) {
+            return;
+        }
+        position = static_cast<CrInt32u>(m_records.size());
+        m_index[code] = static_cast<CrInt16u>(position);
+        PropertyRecord record = {};
+        record.code = code;
+        m_records.push_back(record);
+    }
+
+    PropertyRecord& record = m_records[position];
+    record.reported = true;
+    record.type = static_cast<CrInt16u>(prop.GetValueType());
+    record.enable_flag = prop.GetPropertyEnableFlag();
+    record.variable_flag = prop.GetPropertyVariableFlag();
+    record.readable = prop.IsGetEnableCurrentValue();
+    record.writable = prop.IsSetEnableCurrentValue();
+    record.current = prop.GetCurrentValue();
+
+    if (SDK::CrDataType_STR == record.type) {
+        // Length-prefixed UTF-16, the prefix counts the terminating null
+        CrInt16u const* str = prop.GetCurrentStr();
+        CrInt32u const length = (str && 1 < str[0]) ? str[0] - 1u : 0u;
+        store_values(record, reinterpret_cast<CrInt8u const*>(str ? str + 1 : nullptr), length * sizeof(CrInt16u));
+    }
+    else {
+        store_values(record, prop.GetValues(), prop.GetValues() ? prop.GetValueSize() : 0);
+    }
+}
+
+void PropertyRegistry::mark_unreported()
+{
+    for (auto& record : m_records) {
+        record.reported = false;
+    }
+}
+
+void PropertyRegistry::remove_unreported()
+{
+    std::size_t kept = 0;
+    for (auto const& record : m_records) {
+        if (!record.reported) {
+            m_index[record.code] = static_cast<CrInt16u>(NoRecord);
+            m_stale += record.values_capacity;
+            continue;
+        }
+        m_index[record.code] = static_cast<CrInt16u>(kept);
+        m_records[kept++] = record;
+    }
+    m_records.resize(kept);
+    if (MinCompactSize < m_pool.size() && m_pool.size() < 2 * m_stale) {
+        compact();
+    }
+}
+
+PropertyRecord const* PropertyRegistry::find(CrInt32u code) const
+{
+    if (m_index.size() <= code || NoRecord == m_index[code]) {
+        return nullptr;
+    }
+    return &m_records[m_index[code]];
+}
+
+std::size_t PropertyRegistry::value_count(PropertyRecord const& record) const
+{
+    std::size_t const size = element_size(record.type);
+    return (0 == size) ? 0 : record.values_size / size;
+}
+
+CrInt64 PropertyRegistry::value_at(PropertyRecord const& record, std::size_t index) const
+{
+    std::size_t const size = element_size(record.type);
+    if (0 == size || value_count(record) <= index) {
+        return 0;
+    }
+    CrInt8u const* p = values(record) + index * size;
+    bool const is_signed = 0 != (record.type & SDK::CrDataType_SignBit);
+    switch (size) {
+    case 1: {
+        CrInt8u v;
+        std::memcpy(&v, p, sizeof(v));
+        return is_signed ? static_cast<CrInt64>(static_cast<CrInt8>(v)) : static_cast<CrInt64>(v);
+    }
+    case 2: {
+        CrInt16u v;
+        std::memcpy(&v, p, sizeof(v));
+        return is_signed ? static_cast<CrInt64>(static_cast<CrInt16>(v)) : static_cast<CrInt64>(v);
+    }
+    case 4: {
+        CrInt32u v;
+        std::memcpy(&v, p, sizeof(v));
+        return is_signed ? static_cast<CrInt64>(static_cast<CrInt32>(v)) : static_cast<CrInt64>(v);
+    }
+    default: {
+        CrInt64u v;
+        std::memcpy(&v, p, sizeof(v));
+        return static_cast<CrInt64>(v);
+    }
+    }
+}
+
+text PropertyRegistry::current_text(PropertyRecord const& record) const
+{
+    if (SDK::CrDataType_STR != record.type || 0 == record.values_size) {
+        return text();
+    }
+    std::size_t const length = record.values_size / sizeof(CrInt16u);
+    text result;
+    result.reserve(length);
+    for (std::size_t i = 0; i < length; ++i) {
+        CrInt16u c;
+        std::memcpy(&c, values(record) + i * sizeof(c), sizeof(c));
+#if defined(_WIN32) || defined(_WIN64)
+        result.push_back(static_cast<wchar_t>(c));
+#else
+        char buff[MB_LEN_MAX];
+        int const n = wctomb(buff, static_cast<wchar_t>(c));
+        if (0 < n) {
+            result.append(buff, n);
+        }
+#endif
+    }
+    return result;
+}
+
+std::size_t PropertyRegistry::element_size(CrInt16u type)
+{
+    switch (type & 0x0F) {
+    case SDK::CrDataType_UInt8:
+        return 1;
+    case SDK::CrDataType_UInt16:
+        return 2;
+    case SDK::CrDataType_UInt32:
+        return 4;
+    case SDK::CrDataType_UInt64:
+        return 8;
+    case SDK::CrDataType_UInt128:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+void PropertyRegistry::store_values(PropertyRecord& record, CrInt8u const* data, CrInt32u size)
+{
+    if (!data) {
+        size = 0;
+    }
+    if (record.values_capacity < size) {
+        m_stale += record.values_capacity;
+        if (MinCompactSize < m_pool.size() && m_pool.size() < 2 * m_stale) {
+            record.values_capacity = 0;
+            record.values_size = 0;
+            compact();
+        }
+        record.values_offset = static_cast<CrInt32u>(m_pool.size());
+        record.values_capacity = size;
+        m_pool.resize(m_pool.size() + size);
+    }
+    record.values_size = size;
+    if (0 < size) {
+        std::memcpy(m_pool.data() + record.values_offset, data, size);
+    }
+}
+
+void PropertyRegistry::compact()
+{
+    std::vector<CrInt8u> pool;
+    pool.reserve(m_pool.size() - m_stale);
+    for (auto& record : m_records) {
+        CrInt32u const offset = static_cast<CrInt32u>(pool.size());
+        pool.insert(pool.end(), m_pool.begin() + record.values_offset, m_pool.begin() + record.values_offset + record.values_capacity);
+        record.values_offset = offset;
+    }
+    m_pool.swap(pool);
+    m_stale = 0;
+}
+
+} // namespace cli
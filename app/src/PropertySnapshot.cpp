@@ -0,0 +1,28 @@
+#include "PropertySnapshot.h"
+
+namespace cli
+{
+
+PropertySnapshotBuffer::PropertySnapshotBuffer()
+    : m_current()
+    , m_publish_mtx()
+{
+    auto empty = std::make_shared<PropertySnapshot>();
+    empty->version = 0;
+    empty->loaded = std::chrono::steady_clock::time_point();
+    m_current = std::move(empty);
+}
+
+void PropertySnapshotBuffer::publish(PropertyValueTable const& table)
+{
+    // Copy outside the lock, the table belongs to the writer
+    auto next = std::make_shared<PropertySnapshot>();
+    next->table = table;
+    next->loaded = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_publish_mtx);
+    next->version = std::atomic_load(&m_current)->version + 1;
+    std::atomic_store(&m_current, std::shared_ptr<PropertySnapshot const>(std::move(next)));
+}
+
+} // namespace cli
@@ -0,0 +1,255 @@
+#include "PropertySubscriptions.h"
+#include <algorithm>
+#include "PropertyDecoder.h"
+
+namespace SDK = SCRSDK;
+
+namespace
+{
+// Longest wait between two looks at m_running
+constexpr std::chrono::milliseconds const PollInterval(50);
+// Pause after a failed fetch, e.g. while the camera reconnects
+constexpr std::chrono::milliseconds const RetryDelay(1000);
+} // namespace
+
+namespace cli
+{
+
+PropertySubscriptions::PropertySubscriptions(PropertyHistory* history)
+    : m_device_handle(0)
+    , m_thread()
+    , m_worker_id()
+    , m_running(false)
+    , m_control_mtx()
+    , m_subscriptions(std::make_shared<SubscriptionList const>())
+    , m_subscriptions_mtx()
+    , m_next_id(0)
+    , m_dispatch_mtx()
+    , m_changes()
+    , m_coalesce(DefaultCoalesce.count())
+    , m_history(history)
+    , m_registry()
+    , m_table()
+    , m_codes()
+    , m_snapshot()
+    , m_fetches(0)
+    , m_delivered(0)
+{
+}
+
+PropertySubscriptions::~PropertySubscriptions()
+{
+    close();
+}
+
+void PropertySubscriptions::open(SDK::CrDeviceHandle device_handle)
+{
+    std::lock_guard<std::mutex> lock(m_control_mtx);
+    stop();
+    m_device_handle = device_handle;
+    m_changes.invalidate();
+    start();
+}
+
+void PropertySubscriptions::close()
+{
+    std::lock_guard<std::mutex> lock(m_control_mtx);
+    stop();
+    m_device_handle = 0;
+}
+
+PropertySubscriptions::Id PropertySubscriptions::subscribe(CrInt32u code, PropertySubscriber callback)
+{
+    auto subscriber = std::make_shared<Subscriber>();
+    subscriber->callback = std::move(callback);
+    subscriber->active.store(true, std::memory_order_relaxed);
+    subscriber->primed = false;
+    subscriber->requeued = false;
+
+    Id id = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_subscriptions_mtx);
+        auto next = std::make_shared<SubscriptionList>(*std::atomic_load(&m_subscriptions));
+        id = ++m_next_id;
+        next->push_back(Subscription{ id, code, std::move(subscriber) });
+        std::atomic_store(&m_subscriptions, std::shared_ptr<SubscriptionList const>(std::move(next)));
+    }
+    // Wakes the worker, which fetches the code for the initial value
+    m_changes.push(1, &code);
+    return id;
+}
+
+void PropertySubscriptions::unsubscribe(Id id)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_subscriptions_mtx);
+        auto next = std::make_shared<SubscriptionList>(*std::atomic_load(&m_subscriptions));
+        auto it = std::find_if(next->begin(), next->end(), [id](Subscription const& subscription) { return id == subscription.id; });
+        if (next->end() == it) {
+            return;
+        }
+        it->subscriber->active.store(false, std::memory_order_relaxed);
+        next->erase(it);
+        std::atomic_store(&m_subscriptions, std::shared_ptr<SubscriptionList const>(std::move(next)));
+    }
+    // Wait for a callback which is running right now, unless that is the caller
+    if (std::this_thread::get_id() != m_worker_id.load()) {
+        std::lock_guard<std::mutex> lock(m_dispatch_mtx);
+    }
+}
+
+void PropertySubscriptions::start()
+{
+    if (is_running()) {
+        return;
+    }
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&PropertySubscriptions::run, this);
+}
+
+void PropertySubscriptions::stop()
+{
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    m_worker_id.store(std::thread::id());
+}
+
+void PropertySubscriptions::run()
+{
+    m_worker_id.store(std::this_thread::get_id());
+    while (is_running()) {
+        auto const generation = m_changes.generation();
+        auto const refresh = m_changes.take(m_codes);
+        // After take(), a subscription whose code was taken is in the list
+        auto const subscriptions = std::atomic_load(&m_subscriptions);
+
+        bool fetched = true;
+        switch (refresh) {
+        case PropertyChangeQueue::Refresh::All:
+            fetched = fetch(*subscriptions, m_codes, true);
+            break;
+        case PropertyChangeQueue::Refresh::Codes:
+            fetched = fetch(*subscriptions, m_codes, false);
+            break;
+        default:
+            break;
+        }
+        if (fetched) {
+            prime(*subscriptions);
+        }
+        else {
+            m_changes.invalidate();
+        }
+
+        auto const wait = fetched ? PollInterval : RetryDelay;
+        if (m_changes.wait_push(generation, std::chrono::steady_clock::now() + wait) && fetched) {
+            // The rest of a burst usually follows within a few milliseconds, fetch it in one go
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_coalesce.load(std::memory_order_relaxed)));
+        }
+    }
+}
+
+bool PropertySubscriptions::fetch(SubscriptionList const& subscriptions, std::vector<CrInt32u>& codes, bool all)
+{
+    std::int32_t nprop = 0;
+    SDK::CrDeviceProperty* prop_list = nullptr;
+    auto const status = all
+        ? SDK::GetDeviceProperties(m_device_handle, &prop_list, &nprop)
+        : SDK::GetSelectDeviceProperties(m_device_handle, static_cast<CrInt32u>(codes.size()), codes.data(), &prop_list, &nprop);
+    if (CR_FAILED(status)) {
+        return false;
+    }
+    m_fetches.fetch_add(1, std::memory_order_relaxed);
+
+    if (all) {
+        // Properties missing from the list stay unsupported
+        m_table.media_slot1_quick_format_enable_status.writable = -1;
+        m_table.media_slot2_quick_format_enable_status.writable = -1;
+        m_registry.mark_unreported();
+    }
+    for (std::int32_t i = 0; prop_list && i < nprop; ++i) {
+        auto& prop = prop_list[i];
+        auto const previous = m_registry.find(prop.GetCode());
+        PropertyEvent event;
+        event.code = prop.GetCode();
+        event.old_value = previous ? previous->current : 0;
+        event.initial = !previous;
+        bool const known = previous && SDK::CrDataType_STR != previous->type;
+        m_registry.update(prop);
+        decode_property(m_table, prop);
+        if (m_history) {
+            m_history->loaded(event.code, known, event.old_value, prop.GetCurrentValue());
+        }
+        auto const record = m_registry.find(event.code);
+        if (!record || SDK::CrDataType_STR == record->type) {
+            continue;
+        }
+        event.type = record->type;
+        event.new_value = record->current;
+        if (event.initial) {
+            event.old_value = event.new_value;
+        }
+        else if (event.old_value == event.new_value) {
+            continue;
+        }
+        // Subscriptions without their initial value get it from prime()
+        for (auto const& subscription : subscriptions) {
+            if (event.code == subscription.code && subscription.subscriber->primed) {
+                deliver(subscription, event);
+            }
+        }
+    }
+    if (prop_list) {
+        SDK::ReleaseDeviceProperties(m_device_handle, prop_list);
+    }
+    if (all) {
+        m_registry.remove_unreported();
+    }
+    m_snapshot.publish(m_table);
+    return true;
+}
+
+void PropertySubscriptions::prime(SubscriptionList const& subscriptions)
+{
+    for (auto const& subscription : subscriptions) {
+        auto& subscriber = *subscription.subscriber;
+        if (subscriber.primed) {
+            continue;
+        }
+        auto const record = m_registry.find(subscription.code);
+        if (!record) {
+            // Not reported yet, fetch it once more; after that the first value the camera
+            // reports arrives here
+            if (!subscriber.requeued) {
+                subscriber.requeued = true;
+                m_changes.push(1, &subscription.code);
+            }
+            continue;
+        }
+        subscriber.primed = true;
+        if (SDK::CrDataType_STR == record->type) {
+            continue;
+        }
+        PropertyEvent event;
+        event.code = subscription.code;
+        event.type = record->type;
+        event.old_value = record->current;
+        event.new_value = record->current;
+        event.initial = true;
+        deliver(subscription, event);
+    }
+}
+
+void PropertySubscriptions::deliver(Subscription const& subscription, PropertyEvent const& event)
+{
+    std::lock_guard<std::mutex> lock(m_dispatch_mtx);
+    if (!subscription.subscriber->active.load(std::memory_order_relaxed)) {
+        return;
+    }
+    subscription.subscriber->callback(event);
+    m_delivered.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace cli
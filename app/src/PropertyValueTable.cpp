@@ -1,6 +1,9 @@
 ﻿#include "PropertyValueTable.h"
-#include <cmath>
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <cstring>
+#include <stdexcept>
 #include "CameraDevice.h"
 
 
@@ -8,31 +11,43 @@ namespace SDK = SCRSDK;
 
 namespace impl
 {
+// Copy nval values into values in one go, reusing its capacity.
+// The SDK hands them over packed and in host byte order, so no conversion is needed.
 template <typename T>
-std::vector<T> parse(unsigned char const* buf, std::uint32_t nval)
+void parse(unsigned char const* buf, std::uint32_t nval, cli::PossibleValues<T>& values)
 {
-    constexpr std::size_t const type_size = sizeof(T);
-    std::vector<T> result(nval);
-    std::uint32_t i = 0; T* source = static_cast<T*>(buf);
-    for (; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
+    values.resize(nval);
+    if (0 < nval) {
+        MemCpyEx(values.data(), buf, nval * sizeof(T));
     }
 }
 
-inline double Round(double value, int figure)
+// Name table sorted by value for find_name(), built at compile time
+template <std::size_t N>
+constexpr std::array<cli::ValueName, N> sorted_names(cli::ValueName const (&names)[N])
 {
-    bool isNegative = ( value < 0 );
-    if (isNegative == true) value = -value;
-
-    double rate = std::pow(10.0, figure);
-    //double value1 = value * rate + 0.5;
-
-    long tmp = (long)(value * rate + 0.5);
-    value = tmp/rate;
-
-    if (isNegative == true) value = -value;
+    std::array<cli::ValueName, N> sorted{};
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t j = i;
+        for (; 0 < j && names[i].value < sorted[j - 1].value; --j) {
+            sorted[j] = sorted[j - 1];
+        }
+        if (0 < j && names[i].value == sorted[j - 1].value) {
+            // Not a constant expression, a value named twice fails to compile like a duplicate case label
+            throw std::logic_error("value named twice");
+        }
+        sorted[j] = names[i];
+    }
+    return sorted;
+}
 
-    return value;
+// Binary search, an empty view for values without a name
+template <std::size_t N>
+cli::text_view find_name(std::array<cli::ValueName, N> const& names, std::uint32_t value)
+{
+    auto const found = std::lower_bound(names.begin(), names.end(), value,
+        [](cli::ValueName const& name, std::uint32_t v) { return name.value < v; });
+    return (names.end() != found && value == found->value) ? found->name : cli::text_view();
 }
 
 // Retrieve the hi-order word (16-bit value) of a dword (32-bit value)
@@ -50,2556 +65,1179 @@ constexpr std::uint16_t LOWORD(std::uint32_t dword)
 
 namespace cli
 {
-std::vector<std::uint16_t> parse_f_number(unsigned char const* buf, std::uint32_t nval)
+ValueText& ValueText::append(text_view value)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    std::size_t const count = std::min(value.size(), Capacity - m_size);
+    std::copy_n(value.data(), count, m_data + m_size);
+    m_size += count;
+    return *this;
 }
 
-std::vector<std::uint32_t> parse_iso_sensitivity(unsigned char const* buf, std::uint32_t nval)
+ValueText& ValueText::append_number(std::uint64_t value)
 {
-    using TargetType = std::uint32_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    char digits[20];
+    auto const result = std::to_chars(digits, digits + sizeof(digits), value);
+    std::size_t const count = std::min(static_cast<std::size_t>(result.ptr - digits), Capacity - m_size);
+    std::copy_n(digits, count, m_data + m_size); // widens for wide text
+    m_size += count;
+    return *this;
 }
 
-std::vector<std::uint32_t> parse_shutter_speed(unsigned char const* buf, std::uint32_t nval)
+void parse_f_number(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint32_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_position_key_setting(unsigned char const* buf, std::uint32_t nval)
+void parse_iso_sensitivity(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint32_t> parse_exposure_program_mode(unsigned char const* buf, std::uint32_t nval)
+void parse_shutter_speed(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values)
 {
-    using TargetType = std::uint32_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint32_t> parse_still_capture_mode(unsigned char const* buf, std::uint32_t nval)
+void parse_position_key_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint32_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_focus_mode(unsigned char const* buf, std::uint32_t nval)
+void parse_exposure_program_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_focus_area(unsigned char const* buf, std::uint32_t nval)
+void parse_still_capture_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_live_view_image_quality(unsigned char const* buf, std::uint32_t nval)
+void parse_focus_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_media_slotx_format_enable_status(unsigned char const* buf, std::uint32_t nval)
+void parse_focus_area(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_white_balance(unsigned char const* buf, std::uint32_t nval)
+void parse_live_view_image_quality(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_customwb_capture_standby(unsigned char const* buf, std::uint32_t nval)
+void parse_media_slotx_format_enable_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_customwb_capture_standby_cancel(unsigned char const* buf, std::uint32_t nval)
+void parse_white_balance(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_customwb_capture_operation(unsigned char const* buf, std::uint32_t nval)
+void parse_customwb_capture_standby(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_customwb_capture_execution_state(unsigned char const* buf, std::uint32_t nval)
+void parse_customwb_capture_standby_cancel(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_zoom_operation_status(unsigned char const* buf, std::uint32_t nval)
+void parse_customwb_capture_operation(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_zoom_setting_type(unsigned char const* buf, std::uint32_t nval)
+void parse_customwb_capture_execution_state(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_zoom_types_status(unsigned char const* buf, std::uint32_t nval)
+void parse_zoom_operation_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::int8_t> parse_zoom_operation(unsigned char const* buf, std::uint32_t nval)
+void parse_zoom_setting_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::int8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::int8_t> parse_zoom_speed_range(unsigned char const* buf, std::uint32_t nval)
+void parse_zoom_types_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::int8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_save_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval)
+void parse_zoom_operation(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_load_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval)
+void parse_zoom_speed_range(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_remocon_zoom_speed_type(unsigned char const* buf, std::uint32_t nval)
+void parse_save_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_playback_media(unsigned char const* buf, std::uint32_t nval)
+void parse_load_zoom_and_focus_position(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_gain_base_sensitivity(unsigned char const* buf, std::uint32_t nval)
+void parse_remocon_zoom_speed_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
-std::vector<std::uint8_t> parse_gain_base_iso_sensitivity(unsigned char const* buf, std::uint32_t nval)
+
+void parse_playback_media(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_monitor_lut_setting(unsigned char const* buf, std::uint32_t nval)
+void parse_gain_base_sensitivity(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
+}
+void parse_gain_base_iso_sensitivity(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
+{
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_exposure_index(unsigned char const* buf, std::uint32_t nval)
+void parse_monitor_lut_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_baselook_value(unsigned char const* buf, std::uint32_t nval)
+void parse_exposure_index(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_shutter_mode_setting(unsigned char const* buf, std::uint32_t nval)
+void parse_baselook_value(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_iris_mode_setting(unsigned char const* buf, std::uint32_t nval)
+void parse_shutter_mode_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_gain_control_setting(unsigned char const* buf, std::uint32_t nval)
+void parse_iris_mode_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_exposure_control_type(unsigned char const* buf, std::uint32_t nval)
+void parse_gain_control_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_recording_setting(unsigned char const* buf, std::uint32_t nval)
+void parse_exposure_control_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint32_t> parse_dispmode_candidate(unsigned char const* buf, std::uint32_t nval)
+void parse_recording_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint32_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint32_t> parse_dispmode_setting(unsigned char const* buf, std::uint32_t nval)
+void parse_dispmode_candidate(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values)
 {
-    using TargetType = std::uint32_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_dispmode(unsigned char const* buf, std::uint32_t nval)
+void parse_dispmode_setting(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::int8_t> parse_gain_db_value(unsigned char const* buf, std::int32_t nval)
+void parse_dispmode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::int8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::int32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::int8_t> parse_white_balance_tint(unsigned char const* buf, std::int32_t nval)
+void parse_gain_db_value(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values)
 {
-    using TargetType = std::int8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::int32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::int16_t> parse_white_balance_tint_step(unsigned char const* buf, std::int32_t nval)
+void parse_white_balance_tint(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int8_t>& values)
 {
-    using TargetType = std::int16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::int32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint64_t> parse_shutter_speed_value(unsigned char const* buf, std::uint32_t nval)
+void parse_white_balance_tint_step(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::int16_t>& values)
 {
-    using TargetType = std::uint64_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_focus_bracket_shot_num(unsigned char const* buf, std::uint32_t nval)
+void parse_shutter_speed_value(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint64_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_focus_bracket_focus_range(unsigned char const* buf, std::uint32_t nval)
+void parse_focus_bracket_shot_num(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval)
+void parse_focus_bracket_focus_range(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_movie_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval)
+void parse_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_silent_mode(unsigned char const* buf, std::uint32_t nval)
+void parse_movie_image_stabilization_steady_shot(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_silent_mode_aperture_drive_in_af(unsigned char const* buf, std::uint32_t nval)
+void parse_silent_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
-std::vector<std::uint8_t> parse_silent_mode_shutter_when_power_off(unsigned char const* buf, std::uint32_t nval)
+
+void parse_silent_mode_aperture_drive_in_af(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
+}
+void parse_silent_mode_shutter_when_power_off(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
+{
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_silent_mode_auto_pixel_mapping(unsigned char const* buf, std::uint32_t nval)
+void parse_silent_mode_auto_pixel_mapping(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_shutter_type(unsigned char const* buf, std::uint32_t nval)
+void parse_shutter_type(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_movie_shooting_mode(unsigned char const* buf, std::uint32_t nval)
+void parse_movie_shooting_mode(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint16_t> parse_focus_position(unsigned char const* buf, std::uint32_t nval)
+void parse_focus_position(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint16_t>& values)
 {
-    using TargetType = std::uint16_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_focus_driving_status(unsigned char const* buf, std::uint32_t nval)
+void parse_focus_driving_status(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint32_t> parse_zoom_distance(unsigned char const* buf, std::uint32_t nval)
+void parse_zoom_distance(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint32_t>& values)
 {
-    using TargetType = std::uint32_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-std::vector<std::uint8_t> parse_slotx_rec_available(unsigned char const* buf, std::uint32_t nval)
+void parse_slotx_rec_available(unsigned char const* buf, std::uint32_t nval, PossibleValues<std::uint8_t>& values)
 {
-    using TargetType = std::uint8_t;
-    constexpr std::size_t const type_size = sizeof(TargetType);
-    TargetType const* source = reinterpret_cast<TargetType const*>(buf);
-    std::vector<TargetType> result(nval);
-    for (std::uint32_t i = 0; i < nval; ++i, ++source) {
-        MemCpyEx(&result[i], source, type_size);
-    }
-    return result;
+    impl::parse(buf, nval, values);
 }
 
-text format_f_number(std::uint16_t f_number)
+ValueText format_f_number(std::uint16_t f_number)
 {
-    text_stringstream ts;
+    ValueText value;
     if ((0x0000 == f_number) || (SDK::CrFnumber_Unknown == f_number)) {
-        ts << TEXT("--");
+        value.append(TEXT("--"));
     }
     else if(SDK::CrFnumber_Nothing == f_number) {
         // Do nothing
     }
     else {
-        auto modValue = static_cast<std::uint16_t>(f_number % 100);
-        if (modValue > 0) {
-            ts << TEXT('F') << impl::Round((f_number / 100.0), 1);
+        value.append(TEXT('F'));
+        if (0 < f_number % 100) {
+            // One decimal, rounded half up, without a trailing .0
+            std::uint32_t const tenths = (f_number + 5u) / 10u;
+            value.append_number(tenths / 10);
+            if (0 < tenths % 10) {
+                value.append(TEXT('.')).append_number(tenths % 10);
+            }
         }
         else {
-            ts << TEXT('F') << f_number / 100;
+            value.append_number(f_number / 100);
         }
     }
 
-    return ts.str();
+    return value;
 }
 
-text format_iso_sensitivity(std::uint32_t iso)
+ValueText format_iso_sensitivity(std::uint32_t iso)
 {
-    text_stringstream ts;
+    ValueText value;
 
     std::uint32_t iso_ext = (iso >> 24) & 0x000000F0;  // bit 28-31
     std::uint32_t iso_mode = (iso >> 24) & 0x0000000F; // bit 24-27
     std::uint32_t iso_value = (iso & 0x00FFFFFF);      // bit  0-23
 
     if (iso_mode == SDK::CrISO_MultiFrameNR) {
-        ts << TEXT("Multi Frame NR ");
+        value.append(TEXT("Multi Frame NR "));
     }
     else if (iso_mode == SDK::CrISO_MultiFrameNR_High) {
-        ts << TEXT("Multi Frame NR High ");
+        value.append(TEXT("Multi Frame NR High "));
     }
 
     if (iso_value == SDK::CrISO_AUTO) {
-        ts << TEXT("ISO AUTO");
+        value.append(TEXT("ISO AUTO"));
     }
     else {
-        ts << TEXT("ISO ") << iso_value;
+        value.append(TEXT("ISO ")).append_number(iso_value);
     }
 
     //if (iso_ext == SDK::CrISO_Ext) {
-    //    ts << TEXT(" (EXT)");
+    //    value.append(TEXT(" (EXT)"));
     //}
 
-    return ts.str();
+    return value;
 }
 
-text format_shutter_speed(std::uint32_t shutter_speed)
+ValueText format_shutter_speed(std::uint32_t shutter_speed)
 {
-    text_stringstream ts;
+    ValueText value;
 
     CrInt16u numerator = impl::HIWORD(shutter_speed);
     CrInt16u denominator = impl::LOWORD(shutter_speed);
 
     if (SDK::CrShutterSpeed_Bulb == shutter_speed) {
-        ts << TEXT("Bulb");
+        value.append(TEXT("Bulb"));
     }
     else if(SDK::CrShutterSpeed_Nothing == shutter_speed) {
-        ts << TEXT("Nothing to display");
+        value.append(TEXT("Nothing to display"));
     }
     else if (1 == numerator) {
-        ts << numerator << '/' << denominator;
+        value.append_number(numerator).append(TEXT('/')).append_number(denominator);
     }
     else if (0 == numerator % denominator) {
-        ts << (numerator / denominator) << '"';
+        value.append_number(numerator / denominator).append(TEXT('"'));
     }
     else {
         CrInt32 numdivision = numerator / denominator;
         CrInt32 numremainder = numerator % denominator;
-        ts << numdivision << '.' << numremainder << '"';
+        value.append_number(numdivision).append(TEXT('.')).append_number(numremainder).append(TEXT('"'));
     }
-    return ts.str();
+    return value;
 }
 
-text format_position_key_setting(std::uint16_t position_key_setting)
-{
-    text_stringstream ts;
-
-    switch (position_key_setting) {
-    case SDK::CrPriorityKeySettings::CrPriorityKey_CameraPosition:
-        ts << "Camera Position";
-        break;
-    case SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote:
-        ts << "PC Remote Setting";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
-}
-
-text format_exposure_program_mode(std::uint32_t exposure_program_mode)
-{
-    text_stringstream ts;
-
-    switch (exposure_program_mode) {
-    case SDK::CrExposureProgram::CrExposure_M_Manual:
-        ts << "M_Manual";
-        break;
-    case SDK::CrExposureProgram::CrExposure_P_Auto:
-        ts << "P_Auto";
-        break;
-    case SDK::CrExposureProgram::CrExposure_A_AperturePriority:
-        ts << "A_AperturePriority";
-        break;
-    case SDK::CrExposureProgram::CrExposure_S_ShutterSpeedPriority:
-        ts << "S_ShutterSpeedPriority";
-        break;
-     case SDK::CrExposureProgram::CrExposure_Program_Creative:
-         ts << "ProgramCreative";
-         break;
-     case SDK::CrExposureProgram::CrExposure_Program_Action:
-         ts << "ProgramAction";
-         break;
-    case SDK::CrExposureProgram::CrExposure_Portrait:
-        ts << "Portrait";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Auto:
-        ts << "Auto";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Auto_Plus:
-        ts << "Auto_Plus";
-        break;
-    case SDK::CrExposureProgram::CrExposure_P_A:
-        ts << "P_A";
-        break;
-    case SDK::CrExposureProgram::CrExposure_P_S:
-        ts << "P_S";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Sports_Action:
-        ts << "Sports_Action";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Sunset:
-        ts << "Sunset";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Night:
-        ts << "Night";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Landscape:
-        ts << "Landscape";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Macro:
-        ts << "Macro";
-        break;
-    case SDK::CrExposureProgram::CrExposure_HandheldTwilight:
-        ts << "HandheldTwilight";
-        break;
-    case SDK::CrExposureProgram::CrExposure_NightPortrait:
-        ts << "NightPortrait";
-        break;
-    case SDK::CrExposureProgram::CrExposure_AntiMotionBlur:
-        ts << "AntiMotionBlur";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Pet:
-        ts << "Pet";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Gourmet:
-        ts << "Gourmet";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Fireworks:
-        ts << "Fireworks";
-        break;
-    case SDK::CrExposureProgram::CrExposure_HighSensitivity:
-        ts << "HighSensitivity";
-        break;
-    case SDK::CrExposureProgram::CrExposure_MemoryRecall:
-        ts << "MemoryRecall";
-        break;
-    case SDK::CrExposureProgram::CrExposure_ContinuousPriority_AE_8pics:
-        ts << "ContinuousPriority_AE_8pics";
-        break;
-    case SDK::CrExposureProgram::CrExposure_ContinuousPriority_AE_10pics:
-        ts << "ContinuousPriority_AE_10pics";
-        break;
-    case SDK::CrExposureProgram::CrExposure_ContinuousPriority_AE_12pics:
-        ts << "ContinuousPriority_AE_12pics";
-        break;
-    case SDK::CrExposureProgram::CrExposure_3D_SweepPanorama:
-        ts << "3D_SweepPanorama";
-        break;
-    case SDK::CrExposureProgram::CrExposure_SweepPanorama:
-        ts << "SweepPanorama";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_P:
-        ts << "Movie_P";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_A:
-        ts << "Movie_A";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_S:
-        ts << "Movie_S";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_M:
-        ts << "Movie_M";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_Auto:
-        ts << "Movie_Auto";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_F:
-        ts << "Movie_F";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_SQMotion_P:
-        ts << "Movie_SQMotion_P";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_SQMotion_A:
-        ts << "Movie_SQMotion_A";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_SQMotion_S:
-        ts << "Movie_SQMotion_S";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_SQMotion_M:
-        ts << "Movie_SQMotion_M";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_SQMotion_AUTO:
-        ts << "Movie_SQMotion_AUTO";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_SQMotion_F:
-        ts << "Movie_SQMotion_F";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Flash_Off:
-         ts << "FlashOff";
-         break;
-     case SDK::CrExposureProgram::CrExposure_PictureEffect:
-         ts << "PictureEffect";
-         break;
-    case SDK::CrExposureProgram::CrExposure_HiFrameRate_P:
-        ts << "HiFrameRate_P";
-        break;
-    case SDK::CrExposureProgram::CrExposure_HiFrameRate_A:
-        ts << "HiFrameRate_A";
-        break;
-    case SDK::CrExposureProgram::CrExposure_HiFrameRate_S:
-        ts << "HiFrameRate_S";
-        break;
-    case SDK::CrExposureProgram::CrExposure_HiFrameRate_M:
-        ts << "HiFrameRate_M";
-        break;
-    case SDK::CrExposureProgram::CrExposure_SQMotion_P:
-        ts << "SQMotion_P";
-        break;
-    case SDK::CrExposureProgram::CrExposure_SQMotion_A:
-        ts << "SQMotion_A";
-        break;
-    case SDK::CrExposureProgram::CrExposure_SQMotion_S:
-        ts << "SQMotion_S";
-        break;
-    case SDK::CrExposureProgram::CrExposure_SQMotion_M:
-        ts << "SQMotion_M";
-        break;
-    case SDK::CrExposureProgram::CrExposure_MOVIE:
-        ts << "MOVIE";
-        break;
-    case SDK::CrExposureProgram::CrExposure_STILL:
-        ts << "STILL";
-        break;
-    case SDK::CrExposureProgram::CrExposure_F_MovieOrSQMotion:
-        ts << "F(Movie or S&Q)";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_F:
-        ts << "Movie_IntervalRec_F";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_P:
-        ts << "Movie_IntervalRec_P";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_A:
-        ts << "Movie_IntervalRec_A";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_S:
-        ts << "Movie_IntervalRec_S";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_M:
-        ts << "Movie_IntervalRec_M";
-        break;
-    case SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_AUTO:
-        ts << "Movie_IntervalRec_AUTO";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
-}
-
-text format_still_capture_mode(std::uint32_t still_capture_mode)
-{
-    text_stringstream ts;
-    switch (still_capture_mode) {
-    case SDK::CrDriveMode::CrDrive_Single:
-        ts << "CrDrive_Single";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Hi:
-        ts << "CrDrive_Continuous_Hi";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Hi_Plus:
-        ts << "CrDrive_Continuous_Hi_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Hi_Live:
-        ts << "CrDrive_Continuous_Hi_Live";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Lo:
-        ts << "CrDrive_Continuous_Lo";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous:
-        ts << "CrDrive_Continuous";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_SpeedPriority:
-        ts << "CrDrive_Continuous_SpeedPriority";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Mid:
-        ts << "CrDrive_Continuous_Mid";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Mid_Live:
-        ts << "CrDrive_Continuous_Mid_Live";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Lo_Live:
-        ts << "CrDrive_Continuous_Lo_Live";
-        break;
-    case SDK::CrDriveMode::CrDrive_SingleBurstShooting_lo:
-        ts << "CrDrive_SingleBurstShooting_lo";
-        break;
-    case SDK::CrDriveMode::CrDrive_SingleBurstShooting_mid:
-        ts << "CrDrive_SingleBurstShooting_mid";
-        break;
-    case SDK::CrDriveMode::CrDrive_SingleBurstShooting_hi:
-        ts << "CrDrive_SingleBurstShooting_hi";
-        break;
-    case SDK::CrDriveMode::CrDrive_Timelapse:
-        ts << "CrDrive_Timelapse";
-        break;
-    case SDK::CrDriveMode::CrDrive_Timer_2s:
-        ts << "CrDrive_Timer_2s";
-        break;
-    case SDK::CrDriveMode::CrDrive_Timer_5s:
-        ts << "CrDrive_Timer_5s";
-        break;
-    case SDK::CrDriveMode::CrDrive_Timer_10s:
-        ts << "CrDrive_Timer_10s";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_03Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_03Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_9pics:
-        ts << "CrDrive_Continuous_Bracket_03Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_05Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_05Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_9pics:
-        ts << "CrDrive_Continuous_Bracket_05Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_07Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_07Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_9pics:
-        ts << "CrDrive_Continuous_Bracket_07Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_10Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_10Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_9pics:
-        ts << "CrDrive_Continuous_Bracket_10Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_20Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_20Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_30Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_30Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_03Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_03Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_03Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_05Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_05Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_05Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_07Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_07Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_07Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_10Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_10Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_10Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_13Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_13Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_13Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_13Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_13Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_15Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_15Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_15Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_15Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_15Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_17Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_17Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_17Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_17Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_17Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_20Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_20Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_7pics:
-        ts << "CrDrive_Continuous_Bracket_20Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_23Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_23Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_23Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_23Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_25Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_25Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_25Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_25Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_27Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_27Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_3pics:
-        ts << "CrDrive_Continuous_Bracket_27Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_5pics:
-        ts << "CrDrive_Continuous_Bracket_27Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_2pics_Plus:
-        ts << "CrDrive_Continuous_Bracket_30Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_2pics_Minus:
-        ts << "CrDrive_Continuous_Bracket_30Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_3pics:
-        ts << "CrDrive_Single_Bracket_03Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_5pics:
-        ts << "CrDrive_Single_Bracket_03Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_9pics:
-        ts << "CrDrive_Single_Bracket_03Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_3pics:
-        ts << "CrDrive_Single_Bracket_05Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_5pics:
-        ts << "CrDrive_Single_Bracket_05Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_9pics:
-        ts << "CrDrive_Single_Bracket_05Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_3pics:
-        ts << "CrDrive_Single_Bracket_07Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_5pics:
-        ts << "CrDrive_Single_Bracket_07Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_9pics:
-        ts << "CrDrive_Single_Bracket_07Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_3pics:
-        ts << "CrDrive_Single_Bracket_10Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_5pics:
-        ts << "CrDrive_Single_Bracket_10Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_9pics:
-        ts << "CrDrive_Single_Bracket_10Ev_9pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_3pics:
-        ts << "CrDrive_Single_Bracket_20Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_5pics:
-        ts << "CrDrive_Single_Bracket_20Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_3pics:
-        ts << "CrDrive_Single_Bracket_30Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_5pics:
-        ts << "CrDrive_Single_Bracket_30Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_03Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_03Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_7pics:
-        ts << "CrDrive_Single_Bracket_03Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_05Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_05Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_7pics:
-        ts << "CrDrive_Single_Bracket_05Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_07Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_07Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_7pics:
-        ts << "CrDrive_Single_Bracket_07Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_10Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_10Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_7pics:
-        ts << "CrDrive_Single_Bracket_10Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_13Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_13Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_3pics:
-        ts << "CrDrive_Single_Bracket_13Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_5pics:
-        ts << "CrDrive_Single_Bracket_13Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_7pics:
-        ts << "CrDrive_Single_Bracket_13Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_15Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_15Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_3pics:
-        ts << "CrDrive_Single_Bracket_15Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_5pics:
-        ts << "CrDrive_Single_Bracket_15Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_7pics:
-        ts << "CrDrive_Single_Bracket_15Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_17Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_17Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_3pics:
-        ts << "CrDrive_Single_Bracket_17Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_5pics:
-        ts << "CrDrive_Single_Bracket_17Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_7pics:
-        ts << "CrDrive_Single_Bracket_17Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_20Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_20Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_7pics:
-        ts << "CrDrive_Single_Bracket_20Ev_7pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_23Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_23Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_3pics:
-        ts << "CrDrive_Single_Bracket_23Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_5pics:
-        ts << "CrDrive_Single_Bracket_23Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_25Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_25Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_3pics:
-        ts << "CrDrive_Single_Bracket_25Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_5pics:
-        ts << "CrDrive_Single_Bracket_25Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_27Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_27Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_3pics:
-        ts << "CrDrive_Single_Bracket_27Ev_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_5pics:
-        ts << "CrDrive_Single_Bracket_27Ev_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_2pics_Plus:
-        ts << "CrDrive_Single_Bracket_30Ev_2pics_Plus";
-        break;
-    case SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_2pics_Minus:
-        ts << "CrDrive_Single_Bracket_30Ev_2pics_Minus";
-        break;
-    case SDK::CrDriveMode::CrDrive_WB_Bracket_Lo:
-        ts << "CrDrive_WB_Bracket_Lo";
-        break;
-    case SDK::CrDriveMode::CrDrive_WB_Bracket_Hi:
-        ts << "CrDrive_WB_Bracket_Hi";
-        break;
-    case SDK::CrDriveMode::CrDrive_DRO_Bracket_Lo:
-        ts << "CrDrive_DRO_Bracket_Lo";
-        break;
-    case SDK::CrDriveMode::CrDrive_DRO_Bracket_Hi:
-        ts << "CrDrive_DRO_Bracket_Hi";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Timer_3pics:
-        ts << "CrDrive_Continuous_Timer_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Timer_5pics:
-        ts << "CrDrive_Continuous_Timer_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Timer_2s_3pics:
-        ts << "CrDrive_Continuous_Timer_2s_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Timer_2s_5pics:
-        ts << "CrDrive_Continuous_Timer_2s_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Timer_5s_3pics:
-        ts << "CrDrive_Continuous_Timer_5s_3pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_Continuous_Timer_5s_5pics:
-        ts << "CrDrive_Continuous_Timer_5s_5pics";
-        break;
-    case SDK::CrDriveMode::CrDrive_LPF_Bracket:
-        ts << "CrDrive_LPF_Bracket";
-        break;
-    case SDK::CrDriveMode::CrDrive_RemoteCommander:
-        ts << "CrDrive_RemoteCommander";
-        break;
-    case SDK::CrDriveMode::CrDrive_MirrorUp:
-        ts << "CrDrive_MirrorUp";
-        break;
-    case SDK::CrDriveMode::CrDrive_SelfPortrait_1:
-        ts << "CrDrive_SelfPortrait_1";
-        break;
-    case SDK::CrDriveMode::CrDrive_SelfPortrait_2:
-        ts << "CrDrive_SelfPortrait_2";
-        break;
-    case SDK::CrDriveMode::CrDrive_FocusBracket:
-        ts << "CrDrive_FocusBracket";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
-}
-
-text format_focus_mode(std::uint16_t focus_mode)
-{
-    text_stringstream ts;
-
-    switch (focus_mode) {
-    case SDK::CrFocusMode::CrFocus_MF:
-        ts << "MF";
-        break;
-    case SDK::CrFocusMode::CrFocus_AF_S:
-        ts << "AF_S";
-        break;
-    case SDK::CrFocusMode::CrFocus_AF_C:
-        ts << "AF_C";
-        break;
-    case SDK::CrFocusMode::CrFocus_AF_A:
-        ts << "AF_A";
-        break;
-    case SDK::CrFocusMode::CrFocus_DMF:
-        ts << "DMF";
-        break;
-    case SDK::CrFocusMode::CrFocus_AF_D:
-        ts << "AF_D";
-        break;
-    case SDK::CrFocusMode::CrFocus_PF:
-        ts << "PF";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
-}
-
-text format_focus_area(std::uint16_t focus_area)
-{
-    text_stringstream ts;
-
-    switch (focus_area) {
-    case SDK::CrFocusArea::CrFocusArea_Unknown:
-        ts << "Unknown";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Wide:
-        ts << "Wide";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Zone:
-        ts << "Zone";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Center:
-        ts << "Center";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Flexible_Spot_S:
-        ts << "Flexible Spot S";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Flexible_Spot_M:
-        ts << "Flexible Spot M";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Flexible_Spot_L:
-        ts << "Flexible Spot L";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Expand_Flexible_Spot:
-        ts << "Expand Flexible Spot";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Flexible_Spot:
-        ts << "Flexible Spot";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Wide:
-        ts << "Tracking Wide";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Zone:
-        ts << "Tracking Zone";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Center:
-        ts << "Tracking Center";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot_S:
-        ts << "Tracking Flexible Spot S";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot_M:
-        ts << "Tracking Flexible Spot M";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot_L:
-        ts << "Tracking Flexible Spot L";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Expand_Flexible_Spot:
-        ts << "Tracking Expand Flexible Spot";
-        break;
-    case SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot:
-        ts << "Tracking Flexible Spot";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
+constexpr auto PositionKeySettingNames = impl::sorted_names({
+    { SDK::CrPriorityKeySettings::CrPriorityKey_CameraPosition, TEXT("Camera Position") },
+    { SDK::CrPriorityKeySettings::CrPriorityKey_PCRemote, TEXT("PC Remote Setting") },
+});
+
+text_view format_position_key_setting(std::uint16_t position_key_setting)
+{
+    return impl::find_name(PositionKeySettingNames, position_key_setting);
+}
+
+constexpr auto ExposureProgramModeNames = impl::sorted_names({
+    { SDK::CrExposureProgram::CrExposure_M_Manual, TEXT("M_Manual") },
+    { SDK::CrExposureProgram::CrExposure_P_Auto, TEXT("P_Auto") },
+    { SDK::CrExposureProgram::CrExposure_A_AperturePriority, TEXT("A_AperturePriority") },
+    { SDK::CrExposureProgram::CrExposure_S_ShutterSpeedPriority, TEXT("S_ShutterSpeedPriority") },
+    { SDK::CrExposureProgram::CrExposure_Program_Creative, TEXT("ProgramCreative") },
+    { SDK::CrExposureProgram::CrExposure_Program_Action, TEXT("ProgramAction") },
+    { SDK::CrExposureProgram::CrExposure_Portrait, TEXT("Portrait") },
+    { SDK::CrExposureProgram::CrExposure_Auto, TEXT("Auto") },
+    { SDK::CrExposureProgram::CrExposure_Auto_Plus, TEXT("Auto_Plus") },
+    { SDK::CrExposureProgram::CrExposure_P_A, TEXT("P_A") },
+    { SDK::CrExposureProgram::CrExposure_P_S, TEXT("P_S") },
+    { SDK::CrExposureProgram::CrExposure_Sports_Action, TEXT("Sports_Action") },
+    { SDK::CrExposureProgram::CrExposure_Sunset, TEXT("Sunset") },
+    { SDK::CrExposureProgram::CrExposure_Night, TEXT("Night") },
+    { SDK::CrExposureProgram::CrExposure_Landscape, TEXT("Landscape") },
+    { SDK::CrExposureProgram::CrExposure_Macro, TEXT("Macro") },
+    { SDK::CrExposureProgram::CrExposure_HandheldTwilight, TEXT("HandheldTwilight") },
+    { SDK::CrExposureProgram::CrExposure_NightPortrait, TEXT("NightPortrait") },
+    { SDK::CrExposureProgram::CrExposure_AntiMotionBlur, TEXT("AntiMotionBlur") },
+    { SDK::CrExposureProgram::CrExposure_Pet, TEXT("Pet") },
+    { SDK::CrExposureProgram::CrExposure_Gourmet, TEXT("Gourmet") },
+    { SDK::CrExposureProgram::CrExposure_Fireworks, TEXT("Fireworks") },
+    { SDK::CrExposureProgram::CrExposure_HighSensitivity, TEXT("HighSensitivity") },
+    { SDK::CrExposureProgram::CrExposure_MemoryRecall, TEXT("MemoryRecall") },
+    { SDK::CrExposureProgram::CrExposure_ContinuousPriority_AE_8pics, TEXT("ContinuousPriority_AE_8pics") },
+    { SDK::CrExposureProgram::CrExposure_ContinuousPriority_AE_10pics, TEXT("ContinuousPriority_AE_10pics") },
+    { SDK::CrExposureProgram::CrExposure_ContinuousPriority_AE_12pics, TEXT("ContinuousPriority_AE_12pics") },
+    { SDK::CrExposureProgram::CrExposure_3D_SweepPanorama, TEXT("3D_SweepPanorama") },
+    { SDK::CrExposureProgram::CrExposure_SweepPanorama, TEXT("SweepPanorama") },
+    { SDK::CrExposureProgram::CrExposure_Movie_P, TEXT("Movie_P") },
+    { SDK::CrExposureProgram::CrExposure_Movie_A, TEXT("Movie_A") },
+    { SDK::CrExposureProgram::CrExposure_Movie_S, TEXT("Movie_S") },
+    { SDK::CrExposureProgram::CrExposure_Movie_M, TEXT("Movie_M") },
+    { SDK::CrExposureProgram::CrExposure_Movie_Auto, TEXT("Movie_Auto") },
+    { SDK::CrExposureProgram::CrExposure_Movie_F, TEXT("Movie_F") },
+    { SDK::CrExposureProgram::CrExposure_Movie_SQMotion_P, TEXT("Movie_SQMotion_P") },
+    { SDK::CrExposureProgram::CrExposure_Movie_SQMotion_A, TEXT("Movie_SQMotion_A") },
+    { SDK::CrExposureProgram::CrExposure_Movie_SQMotion_S, TEXT("Movie_SQMotion_S") },
+    { SDK::CrExposureProgram::CrExposure_Movie_SQMotion_M, TEXT("Movie_SQMotion_M") },
+    { SDK::CrExposureProgram::CrExposure_Movie_SQMotion_AUTO, TEXT("Movie_SQMotion_AUTO") },
+    { SDK::CrExposureProgram::CrExposure_Movie_SQMotion_F, TEXT("Movie_SQMotion_F") },
+    { SDK::CrExposureProgram::CrExposure_Flash_Off, TEXT("FlashOff") },
+    { SDK::CrExposureProgram::CrExposure_PictureEffect, TEXT("PictureEffect") },
+    { SDK::CrExposureProgram::CrExposure_HiFrameRate_P, TEXT("HiFrameRate_P") },
+    { SDK::CrExposureProgram::CrExposure_HiFrameRate_A, TEXT("HiFrameRate_A") },
+    { SDK::CrExposureProgram::CrExposure_HiFrameRate_S, TEXT("HiFrameRate_S") },
+    { SDK::CrExposureProgram::CrExposure_HiFrameRate_M, TEXT("HiFrameRate_M") },
+    { SDK::CrExposureProgram::CrExposure_SQMotion_P, TEXT("SQMotion_P") },
+    { SDK::CrExposureProgram::CrExposure_SQMotion_A, TEXT("SQMotion_A") },
+    { SDK::CrExposureProgram::CrExposure_SQMotion_S, TEXT("SQMotion_S") },
+    { SDK::CrExposureProgram::CrExposure_SQMotion_M, TEXT("SQMotion_M") },
+    { SDK::CrExposureProgram::CrExposure_MOVIE, TEXT("MOVIE") },
+    { SDK::CrExposureProgram::CrExposure_STILL, TEXT("STILL") },
+    { SDK::CrExposureProgram::CrExposure_F_MovieOrSQMotion, TEXT("F(Movie or S&Q)") },
+    { SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_F, TEXT("Movie_IntervalRec_F") },
+    { SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_P, TEXT("Movie_IntervalRec_P") },
+    { SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_A, TEXT("Movie_IntervalRec_A") },
+    { SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_S, TEXT("Movie_IntervalRec_S") },
+    { SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_M, TEXT("Movie_IntervalRec_M") },
+    { SDK::CrExposureProgram::CrExposure_Movie_IntervalRec_AUTO, TEXT("Movie_IntervalRec_AUTO") },
+});
+
+text_view format_exposure_program_mode(std::uint32_t exposure_program_mode)
+{
+    return impl::find_name(ExposureProgramModeNames, exposure_program_mode);
+}
+
+constexpr auto StillCaptureModeNames = impl::sorted_names({
+    { SDK::CrDriveMode::CrDrive_Single, TEXT("CrDrive_Single") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Hi, TEXT("CrDrive_Continuous_Hi") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Hi_Plus, TEXT("CrDrive_Continuous_Hi_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Hi_Live, TEXT("CrDrive_Continuous_Hi_Live") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Lo, TEXT("CrDrive_Continuous_Lo") },
+    { SDK::CrDriveMode::CrDrive_Continuous, TEXT("CrDrive_Continuous") },
+    { SDK::CrDriveMode::CrDrive_Continuous_SpeedPriority, TEXT("CrDrive_Continuous_SpeedPriority") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Mid, TEXT("CrDrive_Continuous_Mid") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Mid_Live, TEXT("CrDrive_Continuous_Mid_Live") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Lo_Live, TEXT("CrDrive_Continuous_Lo_Live") },
+    { SDK::CrDriveMode::CrDrive_SingleBurstShooting_lo, TEXT("CrDrive_SingleBurstShooting_lo") },
+    { SDK::CrDriveMode::CrDrive_SingleBurstShooting_mid, TEXT("CrDrive_SingleBurstShooting_mid") },
+    { SDK::CrDriveMode::CrDrive_SingleBurstShooting_hi, TEXT("CrDrive_SingleBurstShooting_hi") },
+    { SDK::CrDriveMode::CrDrive_Timelapse, TEXT("CrDrive_Timelapse") },
+    { SDK::CrDriveMode::CrDrive_Timer_2s, TEXT("CrDrive_Timer_2s") },
+    { SDK::CrDriveMode::CrDrive_Timer_5s, TEXT("CrDrive_Timer_5s") },
+    { SDK::CrDriveMode::CrDrive_Timer_10s, TEXT("CrDrive_Timer_10s") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_3pics, TEXT("CrDrive_Continuous_Bracket_03Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_5pics, TEXT("CrDrive_Continuous_Bracket_03Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_9pics, TEXT("CrDrive_Continuous_Bracket_03Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_3pics, TEXT("CrDrive_Continuous_Bracket_05Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_5pics, TEXT("CrDrive_Continuous_Bracket_05Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_9pics, TEXT("CrDrive_Continuous_Bracket_05Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_3pics, TEXT("CrDrive_Continuous_Bracket_07Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_5pics, TEXT("CrDrive_Continuous_Bracket_07Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_9pics, TEXT("CrDrive_Continuous_Bracket_07Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_3pics, TEXT("CrDrive_Continuous_Bracket_10Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_5pics, TEXT("CrDrive_Continuous_Bracket_10Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_9pics, TEXT("CrDrive_Continuous_Bracket_10Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_3pics, TEXT("CrDrive_Continuous_Bracket_20Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_5pics, TEXT("CrDrive_Continuous_Bracket_20Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_3pics, TEXT("CrDrive_Continuous_Bracket_30Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_5pics, TEXT("CrDrive_Continuous_Bracket_30Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_03Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_03Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_03Ev_7pics, TEXT("CrDrive_Continuous_Bracket_03Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_05Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_05Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_05Ev_7pics, TEXT("CrDrive_Continuous_Bracket_05Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_07Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_07Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_07Ev_7pics, TEXT("CrDrive_Continuous_Bracket_07Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_10Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_10Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_10Ev_7pics, TEXT("CrDrive_Continuous_Bracket_10Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_13Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_13Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_3pics, TEXT("CrDrive_Continuous_Bracket_13Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_5pics, TEXT("CrDrive_Continuous_Bracket_13Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_13Ev_7pics, TEXT("CrDrive_Continuous_Bracket_13Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_15Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_15Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_3pics, TEXT("CrDrive_Continuous_Bracket_15Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_5pics, TEXT("CrDrive_Continuous_Bracket_15Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_15Ev_7pics, TEXT("CrDrive_Continuous_Bracket_15Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_17Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_17Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_3pics, TEXT("CrDrive_Continuous_Bracket_17Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_5pics, TEXT("CrDrive_Continuous_Bracket_17Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_17Ev_7pics, TEXT("CrDrive_Continuous_Bracket_17Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_20Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_20Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_20Ev_7pics, TEXT("CrDrive_Continuous_Bracket_20Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_23Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_23Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_3pics, TEXT("CrDrive_Continuous_Bracket_23Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_23Ev_5pics, TEXT("CrDrive_Continuous_Bracket_23Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_25Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_25Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_3pics, TEXT("CrDrive_Continuous_Bracket_25Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_25Ev_5pics, TEXT("CrDrive_Continuous_Bracket_25Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_27Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_27Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_3pics, TEXT("CrDrive_Continuous_Bracket_27Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_27Ev_5pics, TEXT("CrDrive_Continuous_Bracket_27Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_2pics_Plus, TEXT("CrDrive_Continuous_Bracket_30Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Bracket_30Ev_2pics_Minus, TEXT("CrDrive_Continuous_Bracket_30Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_3pics, TEXT("CrDrive_Single_Bracket_03Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_5pics, TEXT("CrDrive_Single_Bracket_03Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_9pics, TEXT("CrDrive_Single_Bracket_03Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_3pics, TEXT("CrDrive_Single_Bracket_05Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_5pics, TEXT("CrDrive_Single_Bracket_05Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_9pics, TEXT("CrDrive_Single_Bracket_05Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_3pics, TEXT("CrDrive_Single_Bracket_07Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_5pics, TEXT("CrDrive_Single_Bracket_07Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_9pics, TEXT("CrDrive_Single_Bracket_07Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_3pics, TEXT("CrDrive_Single_Bracket_10Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_5pics, TEXT("CrDrive_Single_Bracket_10Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_9pics, TEXT("CrDrive_Single_Bracket_10Ev_9pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_3pics, TEXT("CrDrive_Single_Bracket_20Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_5pics, TEXT("CrDrive_Single_Bracket_20Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_3pics, TEXT("CrDrive_Single_Bracket_30Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_5pics, TEXT("CrDrive_Single_Bracket_30Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_03Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_03Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_03Ev_7pics, TEXT("CrDrive_Single_Bracket_03Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_05Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_05Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_05Ev_7pics, TEXT("CrDrive_Single_Bracket_05Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_07Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_07Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_07Ev_7pics, TEXT("CrDrive_Single_Bracket_07Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_10Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_10Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_10Ev_7pics, TEXT("CrDrive_Single_Bracket_10Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_13Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_13Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_3pics, TEXT("CrDrive_Single_Bracket_13Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_5pics, TEXT("CrDrive_Single_Bracket_13Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_13Ev_7pics, TEXT("CrDrive_Single_Bracket_13Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_15Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_15Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_3pics, TEXT("CrDrive_Single_Bracket_15Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_5pics, TEXT("CrDrive_Single_Bracket_15Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_15Ev_7pics, TEXT("CrDrive_Single_Bracket_15Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_17Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_17Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_3pics, TEXT("CrDrive_Single_Bracket_17Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_5pics, TEXT("CrDrive_Single_Bracket_17Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_17Ev_7pics, TEXT("CrDrive_Single_Bracket_17Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_20Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_20Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_20Ev_7pics, TEXT("CrDrive_Single_Bracket_20Ev_7pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_23Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_23Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_3pics, TEXT("CrDrive_Single_Bracket_23Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_23Ev_5pics, TEXT("CrDrive_Single_Bracket_23Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_25Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_25Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_3pics, TEXT("CrDrive_Single_Bracket_25Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_25Ev_5pics, TEXT("CrDrive_Single_Bracket_25Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_27Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_27Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_3pics, TEXT("CrDrive_Single_Bracket_27Ev_3pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_27Ev_5pics, TEXT("CrDrive_Single_Bracket_27Ev_5pics") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_2pics_Plus, TEXT("CrDrive_Single_Bracket_30Ev_2pics_Plus") },
+    { SDK::CrDriveMode::CrDrive_Single_Bracket_30Ev_2pics_Minus, TEXT("CrDrive_Single_Bracket_30Ev_2pics_Minus") },
+    { SDK::CrDriveMode::CrDrive_WB_Bracket_Lo, TEXT("CrDrive_WB_Bracket_Lo") },
+    { SDK::CrDriveMode::CrDrive_WB_Bracket_Hi, TEXT("CrDrive_WB_Bracket_Hi") },
+    { SDK::CrDriveMode::CrDrive_DRO_Bracket_Lo, TEXT("CrDrive_DRO_Bracket_Lo") },
+    { SDK::CrDriveMode::CrDrive_DRO_Bracket_Hi, TEXT("CrDrive_DRO_Bracket_Hi") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Timer_3pics, TEXT("CrDrive_Continuous_Timer_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Timer_5pics, TEXT("CrDrive_Continuous_Timer_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Timer_2s_3pics, TEXT("CrDrive_Continuous_Timer_2s_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Timer_2s_5pics, TEXT("CrDrive_Continuous_Timer_2s_5pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Timer_5s_3pics, TEXT("CrDrive_Continuous_Timer_5s_3pics") },
+    { SDK::CrDriveMode::CrDrive_Continuous_Timer_5s_5pics, TEXT("CrDrive_Continuous_Timer_5s_5pics") },
+    { SDK::CrDriveMode::CrDrive_LPF_Bracket, TEXT("CrDrive_LPF_Bracket") },
+    { SDK::CrDriveMode::CrDrive_RemoteCommander, TEXT("CrDrive_RemoteCommander") },
+    { SDK::CrDriveMode::CrDrive_MirrorUp, TEXT("CrDrive_MirrorUp") },
+    { SDK::CrDriveMode::CrDrive_SelfPortrait_1, TEXT("CrDrive_SelfPortrait_1") },
+    { SDK::CrDriveMode::CrDrive_SelfPortrait_2, TEXT("CrDrive_SelfPortrait_2") },
+    { SDK::CrDriveMode::CrDrive_FocusBracket, TEXT("CrDrive_FocusBracket") },
+});
+
+text_view format_still_capture_mode(std::uint32_t still_capture_mode)
+{
+    return impl::find_name(StillCaptureModeNames, still_capture_mode);
+}
+
+constexpr auto FocusModeNames = impl::sorted_names({
+    { SDK::CrFocusMode::CrFocus_MF, TEXT("MF") },
+    { SDK::CrFocusMode::CrFocus_AF_S, TEXT("AF_S") },
+    { SDK::CrFocusMode::CrFocus_AF_C, TEXT("AF_C") },
+    { SDK::CrFocusMode::CrFocus_AF_A, TEXT("AF_A") },
+    { SDK::CrFocusMode::CrFocus_DMF, TEXT("DMF") },
+    { SDK::CrFocusMode::CrFocus_AF_D, TEXT("AF_D") },
+    { SDK::CrFocusMode::CrFocus_PF, TEXT("PF") },
+});
+
+text_view format_focus_mode(std::uint16_t focus_mode)
+{
+    return impl::find_name(FocusModeNames, focus_mode);
+}
+
+constexpr auto FocusAreaNames = impl::sorted_names({
+    { SDK::CrFocusArea::CrFocusArea_Unknown, TEXT("Unknown") },
+    { SDK::CrFocusArea::CrFocusArea_Wide, TEXT("Wide") },
+    { SDK::CrFocusArea::CrFocusArea_Zone, TEXT("Zone") },
+    { SDK::CrFocusArea::CrFocusArea_Center, TEXT("Center") },
+    { SDK::CrFocusArea::CrFocusArea_Flexible_Spot_S, TEXT("Flexible Spot S") },
+    { SDK::CrFocusArea::CrFocusArea_Flexible_Spot_M, TEXT("Flexible Spot M") },
+    { SDK::CrFocusArea::CrFocusArea_Flexible_Spot_L, TEXT("Flexible Spot L") },
+    { SDK::CrFocusArea::CrFocusArea_Expand_Flexible_Spot, TEXT("Expand Flexible Spot") },
+    { SDK::CrFocusArea::CrFocusArea_Flexible_Spot, TEXT("Flexible Spot") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Wide, TEXT("Tracking Wide") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Zone, TEXT("Tracking Zone") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Center, TEXT("Tracking Center") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot_S, TEXT("Tracking Flexible Spot S") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot_M, TEXT("Tracking Flexible Spot M") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot_L, TEXT("Tracking Flexible Spot L") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Expand_Flexible_Spot, TEXT("Tracking Expand Flexible Spot") },
+    { SDK::CrFocusArea::CrFocusArea_Tracking_Flexible_Spot, TEXT("Tracking Flexible Spot") },
+});
+
+text_view format_focus_area(std::uint16_t focus_area)
+{
+    return impl::find_name(FocusAreaNames, focus_area);
+}
+
+constexpr auto LiveViewImageQualityNames = impl::sorted_names({
+    { SDK::CrPropertyLiveViewImageQuality::CrPropertyLiveViewImageQuality_High, TEXT("High") },
+    { SDK::CrPropertyLiveViewImageQuality::CrPropertyLiveViewImageQuality_Low, TEXT("Low") },
+});
+
+text_view format_live_view_image_quality(std::uint16_t live_view_image_quality)
+{
+    return impl::find_name(LiveViewImageQualityNames, live_view_image_quality);
+}
+
+constexpr auto MediaSlotxFormatEnableStatusNames = impl::sorted_names({
+    { SDK::CrMediaFormat::CrMediaFormat_Disable, TEXT("Disable") },
+    { SDK::CrMediaFormat::CrMediaFormat_Enable, TEXT("Enabled") },
+});
+
+text_view format_media_slotx_format_enable_status(std::uint8_t media_slotx_format_enable_status)
+{
+    return impl::find_name(MediaSlotxFormatEnableStatusNames, media_slotx_format_enable_status);
 }
+constexpr auto WhiteBalanceNames = impl::sorted_names({
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_AWB, TEXT("AWB") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Underwater_Auto, TEXT("Underwater_Auto") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Daylight, TEXT("Daylight") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Shadow, TEXT("Shadow") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Cloudy, TEXT("Cloudy") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Tungsten, TEXT("Tungsten") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent, TEXT("Fluorescent") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_WarmWhite, TEXT("Fluorescent_WarmWhite") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_CoolWhite, TEXT("Fluorescent_CoolWhite") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_DayWhite, TEXT("Fluorescent_DayWhite") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_Daylight, TEXT("Fluorescent_Daylight") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Flush, TEXT("Flush") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_ColorTemp, TEXT("ColorTemp") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_1, TEXT("Custom_1") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_2, TEXT("Custom_2") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_3, TEXT("Custom_3") },
+    { SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom, TEXT("Custom") },
+});
 
-text format_live_view_image_quality(std::uint16_t live_view_image_quality)
+text_view format_white_balance(std::uint16_t value)
 {
-    text_stringstream ts;
-
-    switch (live_view_image_quality) {
-    case SDK::CrPropertyLiveViewImageQuality::CrPropertyLiveViewImageQuality_High:
-        ts << "High";
-        break;
-    case SDK::CrPropertyLiveViewImageQuality::CrPropertyLiveViewImageQuality_Low:
-        ts << "Low";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
+    return impl::find_name(WhiteBalanceNames, value);
 }
 
-text format_media_slotx_format_enable_status(std::uint8_t media_slotx_format_enable_status)
-{
-    text_stringstream ts;
-
-    switch (media_slotx_format_enable_status) {
-    case SDK::CrMediaFormat::CrMediaFormat_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrMediaFormat::CrMediaFormat_Enable:
-        ts << "Enabled";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
-}
-text format_white_balance(std::uint16_t value)
-{
-    text_stringstream ts;
-
-    switch (value) {
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_AWB:
-        ts << "AWB";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Underwater_Auto:
-        ts << "Underwater_Auto";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Daylight:
-        ts << "Daylight";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Shadow:
-        ts << "Shadow";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Cloudy:
-        ts << "Cloudy";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Tungsten:
-        ts << "Tungsten";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent:
-        ts << "Fluorescent";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_WarmWhite:
-        ts << "Fluorescent_WarmWhite";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_CoolWhite:
-        ts << "Fluorescent_CoolWhite";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_DayWhite:
-        ts << "Fluorescent_DayWhite";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Fluorescent_Daylight:
-        ts << "Fluorescent_Daylight";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Flush:
-        ts << "Flush";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_ColorTemp:
-        ts << "ColorTemp";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_1:
-        ts << "Custom_1";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_2:
-        ts << "Custom_2";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom_3:
-        ts << "Custom_3";
-        break;
-    case SDK::CrWhiteBalanceSetting::CrWhiteBalance_Custom:
-        ts << "Custom";
-        break;
-    default:
-        break;
-    }
+constexpr auto CustomwbCaptureStandbyNames = impl::sorted_names({
+    { SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Disable, TEXT("Disable") },
+    { SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Enable, TEXT("Enable") },
+});
 
-    return ts.str();
-}
-
-text format_customwb_capture_standby(std::uint16_t customwb_capture_standby)
+text_view format_customwb_capture_standby(std::uint16_t customwb_capture_standby)
 {
-    text_stringstream ts;
-
-    switch (customwb_capture_standby) {
-    case SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Enable:
-        ts << "Enable";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
+    return impl::find_name(CustomwbCaptureStandbyNames, customwb_capture_standby);
 }
 
-text format_customwb_capture_standby_cancel(std::uint16_t customwb_capture_standby_cancel)
-{
-    text_stringstream ts;
-
-    switch (customwb_capture_standby_cancel) {
-    case SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Enable:
-        ts << "Enable";
-        break;
+constexpr auto CustomwbCaptureStandbyCancelNames = impl::sorted_names({
+    { SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Disable, TEXT("Disable") },
+    { SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Enable, TEXT("Enable") },
+});
 
-    default:
-        break;
-    }
-
-    return ts.str();
-}
-
-text format_customwb_capture_operation(std::uint16_t customwb_capture_operation)
+text_view format_customwb_capture_standby_cancel(std::uint16_t customwb_capture_standby_cancel)
 {
-    text_stringstream ts;
-
-    switch (customwb_capture_operation) {
-    case SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Enable:
-        ts << "Enabled";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
+    return impl::find_name(CustomwbCaptureStandbyCancelNames, customwb_capture_standby_cancel);
 }
 
-text format_customwb_capture_execution_state(std::uint16_t customwb_capture_execution_state)
-{
-    text_stringstream ts;
+constexpr auto CustomwbCaptureOperationNames = impl::sorted_names({
+    { SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Disable, TEXT("Disable") },
+    { SDK::CrPropertyCustomWBOperation::CrPropertyCustomWBOperation_Enable, TEXT("Enabled") },
+});
 
-    switch (customwb_capture_execution_state) {
-    case SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_Invalid:
-        ts << "Invalid";
-        break;
-    case SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_Standby:
-        ts << "Standby";
-        break;
-    case SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_Capturing:
-        ts << "Capturing";
-        break;
-    case SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_OperatingCamera:
-        ts << "OperatingCamera";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
-}
-
-text format_zoom_operation_status(std::uint8_t zoom_operation_status)
+text_view format_customwb_capture_operation(std::uint16_t customwb_capture_operation)
 {
-    text_stringstream ts;
-
-    switch (zoom_operation_status) {
-    case SDK::CrZoomOperationEnableStatus::CrZoomOperationEnableStatus_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrZoomOperationEnableStatus::CrZoomOperationEnableStatus_Enable:
-        ts << "Enable";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
+    return impl::find_name(CustomwbCaptureOperationNames, customwb_capture_operation);
 }
 
-text format_zoom_setting_type(std::uint8_t zoom_setting_type)
-{
-    text_stringstream ts;
-
-    switch (zoom_setting_type) {
-    case SDK::CrZoomSettingType::CrZoomSetting_OpticalZoomOnly:
-        ts << "OpticalZoom";
-        break;
-    case SDK::CrZoomSettingType::CrZoomSetting_SmartZoomOnly:
-        ts << "SmartZoom";
-        break;
-    case SDK::CrZoomSettingType::CrZoomSetting_On_ClearImageZoom:
-        ts << "ClearImageZoom";
-        break;
-    case SDK::CrZoomSettingType::CrZoomSetting_On_DigitalZoom:
-        ts << "DigitalZoom";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
-}
+constexpr auto CustomwbCaptureExecutionStateNames = impl::sorted_names({
+    { SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_Invalid, TEXT("Invalid") },
+    { SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_Standby, TEXT("Standby") },
+    { SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_Capturing, TEXT("Capturing") },
+    { SDK::CrPropertyCustomWBExecutionState::CrPropertyCustomWBExecutionState_OperatingCamera, TEXT("OperatingCamera") },
+});
 
-text format_zoom_types_status(std::uint8_t zoom_types_status)
+text_view format_customwb_capture_execution_state(std::uint16_t customwb_capture_execution_state)
 {
-    text_stringstream ts;
+    return impl::find_name(CustomwbCaptureExecutionStateNames, customwb_capture_execution_state);
+}
 
-    switch (zoom_types_status) {
-    case SDK::CrZoomTypeStatus::CrZoomTypeStatus_OpticalZoom:
-        ts << "OpticalZoom";
-        break;
-    case SDK::CrZoomTypeStatus::CrZoomTypeStatus_SmartZoom:
-        ts << "SmartZoom";
-        break;
-    case SDK::CrZoomTypeStatus::CrZoomTypeStatus_ClearImageZoom:
-        ts << "ClearImageZoom";
-        break;
-    case SDK::CrZoomTypeStatus::CrZoomTypeStatus_DigitalZoom:
-        ts << "DigitalZoom";
-        break;
-    default:
-        break;
-    }
+constexpr auto ZoomOperationStatusNames = impl::sorted_names({
+    { SDK::CrZoomOperationEnableStatus::CrZoomOperationEnableStatus_Disable, TEXT("Disable") },
+    { SDK::CrZoomOperationEnableStatus::CrZoomOperationEnableStatus_Enable, TEXT("Enable") },
+});
 
-    return ts.str();
+text_view format_zoom_operation_status(std::uint8_t zoom_operation_status)
+{
+    return impl::find_name(ZoomOperationStatusNames, zoom_operation_status);
 }
 
-text format_remocon_zoom_speed_type(std::uint8_t remocon_zoom_speed_type)
+constexpr auto ZoomSettingTypeNames = impl::sorted_names({
+    { SDK::CrZoomSettingType::CrZoomSetting_OpticalZoomOnly, TEXT("OpticalZoom") },
+    { SDK::CrZoomSettingType::CrZoomSetting_SmartZoomOnly, TEXT("SmartZoom") },
+    { SDK::CrZoomSettingType::CrZoomSetting_On_ClearImageZoom, TEXT("ClearImageZoom") },
+    { SDK::CrZoomSettingType::CrZoomSetting_On_DigitalZoom, TEXT("DigitalZoom") },
+});
+
+text_view format_zoom_setting_type(std::uint8_t zoom_setting_type)
 {
-    text_stringstream ts;
+    return impl::find_name(ZoomSettingTypeNames, zoom_setting_type);
+}
 
-    switch (remocon_zoom_speed_type) {
-    case SDK::CrRemoconZoomSpeedType::CrRemoconZoomSpeedType_Invalid:
-        ts << "Invalid";
-        break;
-    case SDK::CrRemoconZoomSpeedType::CrRemoconZoomSpeedType_Variable:
-        ts << "Variable";
-        break;
-    case SDK::CrRemoconZoomSpeedType::CrRemoconZoomSpeedType_Fixed:
-        ts << "Fixed";
-        break;
-    default:
-        break;
-    }
+constexpr auto ZoomTypesStatusNames = impl::sorted_names({
+    { SDK::CrZoomTypeStatus::CrZoomTypeStatus_OpticalZoom, TEXT("OpticalZoom") },
+    { SDK::CrZoomTypeStatus::CrZoomTypeStatus_SmartZoom, TEXT("SmartZoom") },
+    { SDK::CrZoomTypeStatus::CrZoomTypeStatus_ClearImageZoom, TEXT("ClearImageZoom") },
+    { SDK::CrZoomTypeStatus::CrZoomTypeStatus_DigitalZoom, TEXT("DigitalZoom") },
+});
 
-    return ts.str();
+text_view format_zoom_types_status(std::uint8_t zoom_types_status)
+{
+    return impl::find_name(ZoomTypesStatusNames, zoom_types_status);
 }
 
-text format_camera_setting_save_operation(std::uint16_t camera_setting_save_operation)
-{
-    text_stringstream ts;
+constexpr auto RemoconZoomSpeedTypeNames = impl::sorted_names({
+    { SDK::CrRemoconZoomSpeedType::CrRemoconZoomSpeedType_Invalid, TEXT("Invalid") },
+    { SDK::CrRemoconZoomSpeedType::CrRemoconZoomSpeedType_Variable, TEXT("Variable") },
+    { SDK::CrRemoconZoomSpeedType::CrRemoconZoomSpeedType_Fixed, TEXT("Fixed") },
+});
 
-    switch (camera_setting_save_operation) {
-    case SDK::CrCameraSettingSaveOperation::CrCameraSettingSaveOperation_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrCameraSettingSaveOperation::CrCameraSettingSaveOperation_Enable:
-        ts << "Enabled";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_remocon_zoom_speed_type(std::uint8_t remocon_zoom_speed_type)
+{
+    return impl::find_name(RemoconZoomSpeedTypeNames, remocon_zoom_speed_type);
 }
 
-text format_camera_setting_read_operation(std::uint16_t camera_setting_read_operation)
-{
-    text_stringstream ts;
+constexpr auto CameraSettingSaveOperationNames = impl::sorted_names({
+    { SDK::CrCameraSettingSaveOperation::CrCameraSettingSaveOperation_Disable, TEXT("Disable") },
+    { SDK::CrCameraSettingSaveOperation::CrCameraSettingSaveOperation_Enable, TEXT("Enabled") },
+});
 
-    switch (camera_setting_read_operation) {
-    case SDK::CrCameraSettingReadOperation::CrCameraSettingReadOperation_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrCameraSettingReadOperation::CrCameraSettingReadOperation_Enable:
-        ts << "Enabled";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_camera_setting_save_operation(std::uint16_t camera_setting_save_operation)
+{
+    return impl::find_name(CameraSettingSaveOperationNames, camera_setting_save_operation);
 }
 
-text format_camera_setting_save_read_state(std::uint8_t camera_setting_save_read_state)
+constexpr auto CameraSettingReadOperationNames = impl::sorted_names({
+    { SDK::CrCameraSettingReadOperation::CrCameraSettingReadOperation_Disable, TEXT("Disable") },
+    { SDK::CrCameraSettingReadOperation::CrCameraSettingReadOperation_Enable, TEXT("Enabled") },
+});
+
+text_view format_camera_setting_read_operation(std::uint16_t camera_setting_read_operation)
 {
-    text_stringstream ts;
+    return impl::find_name(CameraSettingReadOperationNames, camera_setting_read_operation);
+}
 
-    switch (camera_setting_save_read_state) {
-    case SDK::CrCameraSettingSaveReadState::CrCameraSettingSaveReadState_Idle:
-        ts << "Idle";
-        break;
-    case SDK::CrCameraSettingSaveReadState::CrCameraSettingSaveReadState_Reading:
-        ts << "Reading";
-        break;
-    default:
-        break;
-    }
+constexpr auto CameraSettingSaveReadStateNames = impl::sorted_names({
+    { SDK::CrCameraSettingSaveReadState::CrCameraSettingSaveReadState_Idle, TEXT("Idle") },
+    { SDK::CrCameraSettingSaveReadState::CrCameraSettingSaveReadState_Reading, TEXT("Reading") },
+});
 
-    return ts.str();
+text_view format_camera_setting_save_read_state(std::uint8_t camera_setting_save_read_state)
+{
+    return impl::find_name(CameraSettingSaveReadStateNames, camera_setting_save_read_state);
 }
 
-text format_aps_c_or_full_switching_setting(std::uint8_t aps_c_or_full_switching_setting)
-{
-    text_stringstream ts;
+constexpr auto ApsCOrFullSwitchingSettingNames = impl::sorted_names({
+    { SDK::CrAPS_C_or_Full_SwitchingSetting::CrAPS_C_or_Full_SwitchingSetting_Full, TEXT("Full") },
+    { SDK::CrAPS_C_or_Full_SwitchingSetting::CrAPS_C_or_Full_SwitchingSetting_APS_C, TEXT("APS-C") },
+});
 
-    switch (aps_c_or_full_switching_setting) {
-    case SDK::CrAPS_C_or_Full_SwitchingSetting::CrAPS_C_or_Full_SwitchingSetting_Full:
-        ts << "Full";
-        break;
-    case SDK::CrAPS_C_or_Full_SwitchingSetting::CrAPS_C_or_Full_SwitchingSetting_APS_C:
-        ts << "APS-C";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_aps_c_or_full_switching_setting(std::uint8_t aps_c_or_full_switching_setting)
+{
+    return impl::find_name(ApsCOrFullSwitchingSettingNames, aps_c_or_full_switching_setting);
 }
 
-text format_aps_c_or_full_switching_enable_status(std::uint8_t aps_c_or_full_switching_enable_status)
-{
-    text_stringstream ts;
+constexpr auto ApsCOrFullSwitchingEnableStatusNames = impl::sorted_names({
+    { SDK::CrAPS_C_or_Full_SwitchingEnableStatus::CrAPS_C_or_Full_Switching_Disable, TEXT("Disable") },
+    { SDK::CrAPS_C_or_Full_SwitchingEnableStatus::CrAPS_C_or_Full_Switching_Enable, TEXT("Enable") },
+});
 
-    switch (aps_c_or_full_switching_enable_status) {
-    case SDK::CrAPS_C_or_Full_SwitchingEnableStatus::CrAPS_C_or_Full_Switching_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrAPS_C_or_Full_SwitchingEnableStatus::CrAPS_C_or_Full_Switching_Enable:
-        ts << "Enable";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_aps_c_or_full_switching_enable_status(std::uint8_t aps_c_or_full_switching_enable_status)
+{
+    return impl::find_name(ApsCOrFullSwitchingEnableStatusNames, aps_c_or_full_switching_enable_status);
 }
 
-text format_playback_media(std::uint8_t playback_media)
+constexpr auto PlaybackMediaNames = impl::sorted_names({
+    { SDK::CrPlaybackMedia::CrPlaybackMedia_Slot1, TEXT("Slot1") },
+    { SDK::CrPlaybackMedia::CrPlaybackMedia_Slot2, TEXT("Slot2") },
+});
+
+text_view format_playback_media(std::uint8_t playback_media)
 {
-    text_stringstream ts;
+    return impl::find_name(PlaybackMediaNames, playback_media);
+}
 
-    switch (playback_media) {
-    case SDK::CrPlaybackMedia::CrPlaybackMedia_Slot1:
-        ts << "Slot1";
-        break;
-    case SDK::CrPlaybackMedia::CrPlaybackMedia_Slot2:
-        ts << "Slot2";
-        break;
-    default:
-        break;
-    }
+constexpr auto CameraSettingResetEnableStatusNames = impl::sorted_names({
+    { SDK::CrCameraSettingsResetEnableStatus::CrCameraSettingsReset_Disable, TEXT("Disable") },
+    { SDK::CrCameraSettingsResetEnableStatus::CrCameraSettingsReset_Enable, TEXT("Enable") },
+});
 
-    return ts.str();
+text_view format_camera_setting_reset_enable_status(std::uint8_t camera_setting_reset_enable_status)
+{
+    return impl::find_name(CameraSettingResetEnableStatusNames, camera_setting_reset_enable_status);
 }
 
-text format_camera_setting_reset_enable_status(std::uint8_t camera_setting_reset_enable_status)
-{
-    text_stringstream ts;
+constexpr auto GainBaseSensitivityNames = impl::sorted_names({
+    { SDK::CrGainBaseSensitivity::CrGainBaseSensitivity_High, TEXT("High Level") },
+    { SDK::CrGainBaseSensitivity::CrGainBaseSensitivity_Low, TEXT("Low Level") },
+});
 
-    switch (camera_setting_reset_enable_status) {
-    case SDK::CrCameraSettingsResetEnableStatus::CrCameraSettingsReset_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrCameraSettingsResetEnableStatus::CrCameraSettingsReset_Enable:
-        ts << "Enable";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_gain_base_sensitivity(std::uint8_t gain_base)
+{
+    return impl::find_name(GainBaseSensitivityNames, gain_base);
 }
+constexpr auto GainBaseIsoSensitivityNames = impl::sorted_names({
+    { SDK::CrGainBaseIsoSensitivity::CrGainBaseIsoSensitivity_High, TEXT("High Level") },
+    { SDK::CrGainBaseIsoSensitivity::CrGainBaseIsoSensitivity_Low, TEXT("Low Level") },
+});
 
-text format_gain_base_sensitivity(std::uint8_t gain_base)
+text_view format_gain_base_iso_sensitivity(std::uint8_t gain_base_iso)
 {
-    text_stringstream ts;
-
-    switch (gain_base) {
-    case SDK::CrGainBaseSensitivity::CrGainBaseSensitivity_High:
-        ts << "High Level";
-        break;
-    case SDK::CrGainBaseSensitivity::CrGainBaseSensitivity_Low:
-        ts << "Low Level";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
+    return impl::find_name(GainBaseIsoSensitivityNames, gain_base_iso);
 }
-text format_gain_base_iso_sensitivity(std::uint8_t gain_base_iso)
-{
-    text_stringstream ts;
 
-    switch (gain_base_iso) {
-    case SDK::CrGainBaseIsoSensitivity::CrGainBaseIsoSensitivity_High:
-        ts << "High Level";
-        break;
-    case SDK::CrGainBaseIsoSensitivity::CrGainBaseIsoSensitivity_Low:
-        ts << "Low Level";
-        break;
-    default:
-        break;
-    }
+constexpr auto MonitorLutSettingNames = impl::sorted_names({
+    { SDK::CrMonitorLUTSetting::CrMonitorLUT_OFF, TEXT("OFF") },
+    { SDK::CrMonitorLUTSetting::CrMonitorLUT_ON, TEXT("ON") },
+});
 
-    return ts.str();
+text_view format_monitor_lut_setting(std::uint8_t monitor_setup)
+{
+    return impl::find_name(MonitorLutSettingNames, monitor_setup);
 }
 
-text format_monitor_lut_setting(std::uint8_t monitor_setup)
-{
-    text_stringstream ts;
+constexpr auto BaselookValueNames = impl::sorted_names({
+    { SDK::CrBaseLookValueSetter::CrBaseLookValue_Preset, TEXT("(Preset)") },
+    { SDK::CrBaseLookValueSetter::CrBaseLookValue_User, TEXT("(User)") },
+});
 
-    switch (monitor_setup) {
-    case SDK::CrMonitorLUTSetting::CrMonitorLUT_OFF:
-        ts << "OFF";
-        break;
-    case SDK::CrMonitorLUTSetting::CrMonitorLUT_ON:
-        ts << "ON";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_baselook_value(std::uint8_t baselook_value)
+{
+    return impl::find_name(BaselookValueNames, baselook_value);
 }
 
-text format_baselook_value(std::uint8_t baselook_value)
-{
-    text_stringstream ts;
+constexpr auto ShutterModeSettingNames = impl::sorted_names({
+    { SDK::CrShutterModeSetting::CrShutterMode_Automatic, TEXT("Automatic") },
+    { SDK::CrShutterModeSetting::CrShutterMode_Manual, TEXT("Manual") },
+});
 
-    switch (baselook_value) {
-    case SDK::CrBaseLookValueSetter::CrBaseLookValue_Preset:
-        ts << "(Preset)";
-        break;
-    case SDK::CrBaseLookValueSetter::CrBaseLookValue_User:
-        ts << "(User)";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_shutter_mode_setting(std::uint8_t shutter_mode_setting)
+{
+    return impl::find_name(ShutterModeSettingNames, shutter_mode_setting);
 }
 
-text format_shutter_mode_setting(std::uint8_t shutter_mode_setting)
+constexpr auto IrisModeSettingNames = impl::sorted_names({
+    { SDK::CrIrisModeSetting::CrIrisMode_Automatic, TEXT("Automatic") },
+    { SDK::CrIrisModeSetting::CrIrisMode_Manual, TEXT("Manual") },
+});
+
+text_view format_iris_mode_setting(std::uint8_t iris_mode_setting)
 {
-    text_stringstream ts;
+    return impl::find_name(IrisModeSettingNames, iris_mode_setting);
+}
 
-    switch (shutter_mode_setting) {
-    case SDK::CrShutterModeSetting::CrShutterMode_Automatic:
-        ts << "Automatic";
-        break;
-    case SDK::CrShutterModeSetting::CrShutterMode_Manual:
-        ts << "Manual";
-        break;
-    default:
-        break;
-    }
+constexpr auto ExposureControlTypeNames = impl::sorted_names({
+    { SDK::CrExposureCtrlType::CrExposureCtrlType_PASMMode, TEXT("P/A/S/M Mode") },
+    { SDK::CrExposureCtrlType::CrExposureCtrlType_FlexibleExposureMode, TEXT("Flexible Exposure Mode") },
+});
 
-    return ts.str();
+text_view format_exposure_control_type(std::uint8_t exposure_control_type)
+{
+    return impl::find_name(ExposureControlTypeNames, exposure_control_type);
 }
 
-text format_iris_mode_setting(std::uint8_t iris_mode_setting)
+constexpr auto GainControlSettingNames = impl::sorted_names({
+    { SDK::CrGainControlSetting::CrGainControl_Automatic, TEXT("Automatic") },
+    { SDK::CrGainControlSetting::CrGainControl_Manual, TEXT("Manual") },
+});
+
+text_view format_gain_control_setting(std::uint8_t gain_control_setting)
 {
-    text_stringstream ts;
+    return impl::find_name(GainControlSettingNames, gain_control_setting);
+}
 
-    switch (iris_mode_setting) {
-    case SDK::CrIrisModeSetting::CrIrisMode_Automatic:
-        ts << "Automatic";
-        break;
-    case SDK::CrIrisModeSetting::CrIrisMode_Manual:
-        ts << "Manual";
-        break;
-    default:
-        break;
-    }
+constexpr auto RecordingSettingNames = impl::sorted_names({
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60p_50M, TEXT("60p 50M / XAVC S") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_50M, TEXT("30p 50M / XAVC S") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_50M, TEXT("24p 50M / XAVC S") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50p_50M, TEXT("50p 50M / XAVC S") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_50M, TEXT("25p 50M / XAVC S") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60i_24M, TEXT("60i 24M(FX) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50i_24M_FX, TEXT("50i 24M(FX) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60i_17M_FH, TEXT("60i 17M(FH) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50i_17M_FH, TEXT("50i 17M(FH) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60p_28M_PS, TEXT("60p 28M(PS) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50p_28M_PS, TEXT("50p 28M(PS) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_24M_FX, TEXT("24p 24M(FX) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_24M_FX, TEXT("25p 24M(FX) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_17M_FH, TEXT("24p 17M(FH) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_17M_FH, TEXT("25p 17M(FH) / AVCHD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_120p_50M_1280x720, TEXT("120p 50M (1280x720) / XAVC S") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100p_50M_1280x720, TEXT("100p 50M (1280x720) / XAVC S") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_30p_16M, TEXT("1920x1080 30p 16M / MP4") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_25p_16M, TEXT("1920x1080 25p 16M / MP4") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1280x720_30p_6M, TEXT("1280x720 30p 6M / MP4") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1280x720_25p_6M, TEXT("1280x720 25p 6M / MP4") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_60p_28M, TEXT("1920x1080 60p 28M / MP4") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_50p_28M, TEXT("1920x1080 50p 28M / MP4") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60p_25M_XAVC_S_HD, TEXT("60p 25M / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50p_25M_XAVC_S_HD, TEXT("50p 25M / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_16M_XAVC_S_HD, TEXT("30p 16M / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_16M_XAVC_S_HD, TEXT("25p 16M / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_120p_100M_1920x1080_XAVC_S_HD, TEXT("120p 100M (1920x1080)  / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100p_100M_1920x1080_XAVC_S_HD, TEXT("100p 100M (1920x1080)  / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_120p_60M_1920x1080_XAVC_S_HD, TEXT("120p 60M (1920x1080) / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100p_60M_1920x1080_XAVC_S_HD, TEXT("100p 60M (1920x1080) / XAVC S HD") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_100M_XAVC_S_4K, TEXT("30p 100M / XAVC S 4K") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_100M_XAVC_S_4K, TEXT("25p 100M / XAVC S 4K") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_100M_XAVC_S_4K, TEXT("24p 100M / XAVC S 4K") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_60M_XAVC_S_4K, TEXT("30p 60M / XAVC S 4K") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_60M_XAVC_S_4K, TEXT("25p 60M / XAVC S 4K") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_60M_XAVC_S_4K, TEXT("24p 60M / XAVC S 4K") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_600M_422_10bit, TEXT("600M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_500M_422_10bit, TEXT("500M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_400M_420_10bit, TEXT("400M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_300M_422_10bit, TEXT("300M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_280M_422_10bit, TEXT("280M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_250M_422_10bit, TEXT("250M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_240M_422_10bit, TEXT("240M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_222M_422_10bit, TEXT("222M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_200M_422_10bit, TEXT("200M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_200M_420_10bit, TEXT("200M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_200M_420_8bit, TEXT("200M 420 8bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_185M_422_10bit, TEXT("185M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_150M_420_10bit, TEXT("150M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_150M_420_8bit, TEXT("150M 420 8bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_140M_422_10bit, TEXT("140M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_111M_422_10bit, TEXT("111M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100M_422_10bit, TEXT("100M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100M_420_10bit, TEXT("100M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100M_420_8bit, TEXT("100M 420 8bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_93M_422_10bit, TEXT("93M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_89M_422_10bit, TEXT("89M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_75M_420_10bit, TEXT("75M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60M_420_8bit, TEXT("60M 420 8bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50M_422_10bit, TEXT("50M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50M_420_10bit, TEXT("50M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50M_420_8bit, TEXT("50M 420 8bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_45M_420_10bit, TEXT("45M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30M_420_10bit, TEXT("30M 420 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25M_420_8bit, TEXT("25M 420 8bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_16M_420_8bit, TEXT("16M 420 8bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_520M_422_10bit, TEXT("520M 422 10bit") },
+    { SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_260M_422_10bit, TEXT("260M 422 10bit") },
+});
+
+text_view format_recording_setting(std::uint16_t recording_setting)
+{
+    return impl::find_name(RecordingSettingNames, recording_setting);
+}
+
+constexpr auto DispmodeNames = impl::sorted_names({
+    { SDK::CrDispMode::CrDispMode_GraphicDisplay, TEXT("Graphic Display") },
+    { SDK::CrDispMode::CrDispMode_DisplayAllInfo, TEXT("Display All Information") },
+    { SDK::CrDispMode::CrDispMode_NoDispInfo, TEXT("No Display Information") },
+    { SDK::CrDispMode::CrDispMode_Histogram, TEXT("Histogram") },
+    { SDK::CrDispMode::CrDispMode_Level, TEXT("Level") },
+    { SDK::CrDispMode::CrDispMode_ForViewFinder, TEXT("For viewfinder") },
+    { SDK::CrDispMode::CrDispMode_MonitorOff, TEXT("Monitor Off") },
+});
+
+text_view format_dispmode(std::uint8_t dispmode)
+{
+    return impl::find_name(DispmodeNames, dispmode);
+}
+
+constexpr auto MovieRecButtonToggleEnableStatusNames = impl::sorted_names({
+    { SDK::CrMovieRecButtonToggleEnableStatus::CrMovieRecButtonToggle_Disable, TEXT("Disable") },
+    { SDK::CrMovieRecButtonToggleEnableStatus::CrMovieRecButtonToggle_Enable, TEXT("Enable") },
+});
+
+text_view format_movie_rec_button_toggle_enable_status(std::uint8_t movie_rec_button_toggle_enable_status)
+{
+    return impl::find_name(MovieRecButtonToggleEnableStatusNames, movie_rec_button_toggle_enable_status);
+}
+
+ValueText format_shutter_speed_value(std::uint64_t shutter_speed_value)
+{
+    ValueText value;
 
-    return ts.str();
+    CrInt32u numerator = (CrInt32u)(shutter_speed_value >> 32);
+    CrInt32u denominator = (CrInt32u)(shutter_speed_value & 0x0000FFFF);
+    value.append_number(numerator).append(TEXT('/')).append_number(denominator);
+    return value;
 }
 
-text format_exposure_control_type(std::uint8_t exposure_control_type)
-{
-    text_stringstream ts;
+constexpr auto MediaSlotxStatusNames = impl::sorted_names({
+    { SDK::CrSlotStatus::CrSlotStatus_OK, TEXT("OK") },
+    { SDK::CrSlotStatus::CrSlotStatus_NoCard, TEXT("No Card") },
+    { SDK::CrSlotStatus::CrSlotStatus_CardError, TEXT("Card Error") },
+    { SDK::CrSlotStatus::CrSlotStatus_RecognizingOrLockedError, TEXT("Recognizing Or LockedError") },
+});
 
-    switch (exposure_control_type) {
-    case SDK::CrExposureCtrlType::CrExposureCtrlType_PASMMode:
-        ts << "P/A/S/M Mode";
-        break;
-    case SDK::CrExposureCtrlType::CrExposureCtrlType_FlexibleExposureMode:
-        ts << "Flexible Exposure Mode";
-        break;
-    default:
-        break;
-    }
-
-    return ts.str();
+text_view format_media_slotx_status(std::uint8_t media_slotx_status)
+{
+    return impl::find_name(MediaSlotxStatusNames, media_slotx_status);
 }
 
-text format_gain_control_setting(std::uint8_t gain_control_setting)
-{
-    text_stringstream ts;
+constexpr auto ImageStabilizationSteadyShotNames = impl::sorted_names({
+    { SDK::CrImageStabilizationSteadyShot::CrImageStabilizationSteadyShot_Off, TEXT("OFF") },
+    { SDK::CrImageStabilizationSteadyShot::CrImageStabilizationSteadyShot_On, TEXT("ON") },
+});
 
-    switch (gain_control_setting) {
-    case SDK::CrGainControlSetting::CrGainControl_Automatic:
-        ts << "Automatic";
-        break;
-    case SDK::CrGainControlSetting::CrGainControl_Manual:
-        ts << "Manual";
-        break;
-    default:
-        break;
-    }
+text_view format_image_stabilization_steady_shot(std::uint8_t image_stabilization_steady_shot)
+{
+    return impl::find_name(ImageStabilizationSteadyShotNames, image_stabilization_steady_shot);
+}
 
-    return ts.str();
-}
-
-text format_recording_setting(std::uint16_t recording_setting)
-{
-    //SDK::CrRecordingSettingMovie
-    text_stringstream ts;
-    switch (recording_setting)
-    {
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60p_50M:
-        ts << "60p 50M / XAVC S";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_50M:
-        ts << "30p 50M / XAVC S";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_50M:
-        ts << "24p 50M / XAVC S";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50p_50M:
-        ts << "50p 50M / XAVC S";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_50M:
-        ts << "25p 50M / XAVC S";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60i_24M:
-        ts << "60i 24M(FX) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50i_24M_FX:
-        ts << "50i 24M(FX) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60i_17M_FH:
-        ts << "60i 17M(FH) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50i_17M_FH:
-        ts << "50i 17M(FH) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60p_28M_PS:
-        ts << "60p 28M(PS) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50p_28M_PS:
-        ts << "50p 28M(PS) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_24M_FX:
-        ts << "24p 24M(FX) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_24M_FX:
-        ts << "25p 24M(FX) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_17M_FH:
-        ts << "24p 17M(FH) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_17M_FH:
-        ts << "25p 17M(FH) / AVCHD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_120p_50M_1280x720:
-        ts << "120p 50M (1280x720) / XAVC S";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100p_50M_1280x720:
-        ts << "100p 50M (1280x720) / XAVC S";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_30p_16M:
-        ts << "1920x1080 30p 16M / MP4";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_25p_16M:
-        ts << "1920x1080 25p 16M / MP4";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1280x720_30p_6M:
-        ts << "1280x720 30p 6M / MP4";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1280x720_25p_6M:
-        ts << "1280x720 25p 6M / MP4";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_60p_28M:
-        ts << "1920x1080 60p 28M / MP4";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_1920x1080_50p_28M:
-        ts << "1920x1080 50p 28M / MP4";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60p_25M_XAVC_S_HD:
-        ts << "60p 25M / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50p_25M_XAVC_S_HD:
-        ts << "50p 25M / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_16M_XAVC_S_HD:
-        ts << "30p 16M / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_16M_XAVC_S_HD:
-        ts << "25p 16M / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_120p_100M_1920x1080_XAVC_S_HD:
-        ts << "120p 100M (1920x1080)  / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100p_100M_1920x1080_XAVC_S_HD:
-        ts << "100p 100M (1920x1080)  / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_120p_60M_1920x1080_XAVC_S_HD:
-        ts << "120p 60M (1920x1080) / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100p_60M_1920x1080_XAVC_S_HD:
-        ts << "100p 60M (1920x1080) / XAVC S HD";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_100M_XAVC_S_4K:
-        ts << "30p 100M / XAVC S 4K";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_100M_XAVC_S_4K:
-        ts << "25p 100M / XAVC S 4K";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_100M_XAVC_S_4K:
-        ts << "24p 100M / XAVC S 4K";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30p_60M_XAVC_S_4K:
-        ts << "30p 60M / XAVC S 4K";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25p_60M_XAVC_S_4K:
-        ts << "25p 60M / XAVC S 4K";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_24p_60M_XAVC_S_4K:
-        ts << "24p 60M / XAVC S 4K";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_600M_422_10bit:
-        ts << "600M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_500M_422_10bit:
-        ts << "500M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_400M_420_10bit:
-        ts << "400M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_300M_422_10bit:
-        ts << "300M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_280M_422_10bit:
-        ts << "280M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_250M_422_10bit:
-        ts << "250M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_240M_422_10bit:
-        ts << "240M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_222M_422_10bit:
-        ts << "222M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_200M_422_10bit:
-        ts << "200M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_200M_420_10bit:
-        ts << "200M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_200M_420_8bit:
-        ts << "200M 420 8bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_185M_422_10bit:
-        ts << "185M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_150M_420_10bit:
-        ts << "150M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_150M_420_8bit:
-        ts << "150M 420 8bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_140M_422_10bit:
-        ts << "140M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_111M_422_10bit:
-        ts << "111M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100M_422_10bit:
-        ts << "100M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100M_420_10bit:
-        ts << "100M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_100M_420_8bit:
-        ts << "100M 420 8bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_93M_422_10bit:
-        ts << "93M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_89M_422_10bit:
-        ts << "89M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_75M_420_10bit:
-        ts << "75M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_60M_420_8bit:
-        ts << "60M 420 8bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50M_422_10bit:
-        ts << "50M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50M_420_10bit:
-        ts << "50M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_50M_420_8bit:
-        ts << "50M 420 8bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_45M_420_10bit:
-        ts << "45M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_30M_420_10bit:
-        ts << "30M 420 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_25M_420_8bit:
-        ts << "25M 420 8bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_16M_420_8bit:
-        ts << "16M 420 8bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_520M_422_10bit:
-        ts << "520M 422 10bit";
-        break;
-    case SDK::CrRecordingSettingMovie::CrRecordingSettingMovie_260M_422_10bit:
-        ts << "260M 422 10bit";
-        break;
-    default:
-        break;
-    }
+constexpr auto MovieImageStabilizationSteadyShotNames = impl::sorted_names({
+    { SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_Off, TEXT("OFF") },
+    { SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_Standard, TEXT("Standard") },
+    { SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_Active, TEXT("Active") },
+    { SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_DynamicActive, TEXT("Dynamic active") },
+});
 
-    return ts.str();
-}
-
-text format_dispmode(std::uint8_t dispmode)
-{
-    text_stringstream ts;
-    switch (dispmode)
-    {
-    case SDK::CrDispMode::CrDispMode_GraphicDisplay:
-        ts << "Graphic Display";
-        break;
-    case SDK::CrDispMode::CrDispMode_DisplayAllInfo:
-        ts << "Display All Information";
-        break;
-    case SDK::CrDispMode::CrDispMode_NoDispInfo:
-        ts << "No Display Information";
-        break;
-    case SDK::CrDispMode::CrDispMode_Histogram:
-        ts << "Histogram";
-        break;
-    case SDK::CrDispMode::CrDispMode_Level:
-        ts << "Level";
-        break;
-    case SDK::CrDispMode::CrDispMode_ForViewFinder:
-        ts << "For viewfinder";
-        break;
-    case SDK::CrDispMode::CrDispMode_MonitorOff:
-        ts << "Monitor Off";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_movie_image_stabilization_steady_shot(std::uint8_t movie_image_stabilization_steady_shot)
+{
+    return impl::find_name(MovieImageStabilizationSteadyShotNames, movie_image_stabilization_steady_shot);
 }
 
-text format_movie_rec_button_toggle_enable_status(std::uint8_t movie_rec_button_toggle_enable_status)
-{
-    text_stringstream ts;
+constexpr auto SilentModeNames = impl::sorted_names({
+    { SDK::CrSilentMode::CrSilentMode_Off, TEXT("OFF") },
+    { SDK::CrSilentMode::CrSilentMode_On, TEXT("ON") },
+});
 
-    switch (movie_rec_button_toggle_enable_status) {
-    case SDK::CrMovieRecButtonToggleEnableStatus::CrMovieRecButtonToggle_Disable:
-        ts << "Disable";
-        break;
-    case SDK::CrMovieRecButtonToggleEnableStatus::CrMovieRecButtonToggle_Enable:
-        ts << "Enable";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_silent_mode(std::uint8_t silent_mode)
+{
+    return impl::find_name(SilentModeNames, silent_mode);
 }
 
-text format_shutter_speed_value(std::uint64_t shutter_speed_value)
-{
-    text_stringstream ts;
+constexpr auto SilentModeApertureDriveInAfNames = impl::sorted_names({
+    { SDK::CrSilentModeApertureDriveInAF::CrSilentModeApertureDriveInAF_NotTarget, TEXT("Not Target") },
+    { SDK::CrSilentModeApertureDriveInAF::CrSilentModeApertureDriveInAF_Standard, TEXT("Standard") },
+    { SDK::CrSilentModeApertureDriveInAF::CrSilentModeApertureDriveInAF_SilentPriority, TEXT("Silent Priority") },
+});
 
-    CrInt32u numerator = (CrInt32u)(shutter_speed_value >> 32);
-    CrInt32u denominator = (CrInt32u)(shutter_speed_value & 0x0000FFFF);
-    ts << numerator << '/' << denominator;
-    return ts.str();
-}
-
-text format_media_slotx_status(std::uint8_t media_slotx_status)
-{
-    text_stringstream ts;
-
-    switch (media_slotx_status) {
-    case SDK::CrSlotStatus::CrSlotStatus_OK:
-        ts << "OK";
-        break;
-    case SDK::CrSlotStatus::CrSlotStatus_NoCard:
-        ts << "No Card";
-        break;
-    case SDK::CrSlotStatus::CrSlotStatus_CardError:
-        ts << "Card Error";
-        break;
-    case SDK::CrSlotStatus::CrSlotStatus_RecognizingOrLockedError:
-        ts << "Recognizing Or LockedError";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_silent_mode_aperture_drive_in_af(std::uint8_t aperture_drive_in_af)
+{
+    return impl::find_name(SilentModeApertureDriveInAfNames, aperture_drive_in_af);
 }
 
-text format_image_stabilization_steady_shot(std::uint8_t image_stabilization_steady_shot)
-{
-    text_stringstream ts;
+constexpr auto SilentModeShutterWhenPowerOffNames = impl::sorted_names({
+    { SDK::CrSilentModeShutterWhenPowerOff::CrSilentModeShutterWhenPowerOff_NotTarget, TEXT("Not Target") },
+    { SDK::CrSilentModeShutterWhenPowerOff::CrSilentModeShutterWhenPowerOff_Off, TEXT("OFF") },
+});
 
-    switch (image_stabilization_steady_shot) {
-    case SDK::CrImageStabilizationSteadyShot::CrImageStabilizationSteadyShot_Off:
-        ts << "OFF";
-        break;
-    case SDK::CrImageStabilizationSteadyShot::CrImageStabilizationSteadyShot_On:
-        ts << "ON";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
-}
-
-text format_movie_image_stabilization_steady_shot(std::uint8_t movie_image_stabilization_steady_shot)
-{
-    text_stringstream ts;
-
-    switch (movie_image_stabilization_steady_shot) {
-    case SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_Off:
-        ts << "OFF";
-        break;
-    case SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_Standard:
-        ts << "Standard";
-        break;
-    case SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_Active:
-        ts << "Active";
-        break;
-    case SDK::CrImageStabilizationSteadyShotMovie::CrImageStabilizationSteadyShotMovie_DynamicActive:
-        ts << "Dynamic active";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_silent_mode_shutter_when_power_off(std::uint8_t when_power_off)
+{
+    return impl::find_name(SilentModeShutterWhenPowerOffNames, when_power_off);
 }
+constexpr auto SilentModeAutoPixelMappingNames = impl::sorted_names({
+    { SDK::CrSilentModeAutoPixelMapping::CrSilentModeAutoPixelMapping_NotTarget, TEXT("Not Target") },
+    { SDK::CrSilentModeAutoPixelMapping::CrSilentModeAutoPixelMapping_Off, TEXT("OFF") },
+});
 
-text format_silent_mode(std::uint8_t silent_mode)
+text_view format_silent_mode_auto_pixel_mapping(std::uint8_t auto_pixel_mapping)
 {
-    text_stringstream ts;
-
-    switch (silent_mode) {
-    case SDK::CrSilentMode::CrSilentMode_Off:
-        ts << "OFF";
-        break;
-    case SDK::CrSilentMode::CrSilentMode_On:
-        ts << "ON";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+    return impl::find_name(SilentModeAutoPixelMappingNames, auto_pixel_mapping);
 }
 
-text format_silent_mode_aperture_drive_in_af(std::uint8_t aperture_drive_in_af)
-{
-    text_stringstream ts;
+constexpr auto ShutterTypeNames = impl::sorted_names({
+    { SDK::CrShutterType::CrShutterType_Auto, TEXT("Auto") },
+    { SDK::CrShutterType::CrShutterType_MechanicalShutter, TEXT("Mechanical Shutter") },
+    { SDK::CrShutterType::CrShutterType_ElectronicShutter, TEXT("Electronic Shutter") },
+});
 
-    switch (aperture_drive_in_af) {
-    case SDK::CrSilentModeApertureDriveInAF::CrSilentModeApertureDriveInAF_NotTarget:
-        ts << "Not Target";
-        break;
-    case SDK::CrSilentModeApertureDriveInAF::CrSilentModeApertureDriveInAF_Standard:
-        ts << "Standard";
-        break;
-    case SDK::CrSilentModeApertureDriveInAF::CrSilentModeApertureDriveInAF_SilentPriority:
-        ts << "Silent Priority";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_shutter_type(std::uint8_t shutter_type)
+{
+    return impl::find_name(ShutterTypeNames, shutter_type);
 }
 
-text format_silent_mode_shutter_when_power_off(std::uint8_t when_power_off)
-{
-    text_stringstream ts;
+constexpr auto MovieShootingModeNames = impl::sorted_names({
+    { SDK::CrMovieShootingMode::CrMovieShootingMode_Off, TEXT("OFF") },
+    { SDK::CrMovieShootingMode::CrMovieShootingMode_CineEI, TEXT("Cine EI") },
+    { SDK::CrMovieShootingMode::CrMovieShootingMode_CineEIQuick, TEXT("Cine EI Quick") },
+    { SDK::CrMovieShootingMode::CrMovieShootingMode_Custom, TEXT("Custom") },
+    { SDK::CrMovieShootingMode::CrMovieShootingMode_FlexibleISO, TEXT("Flexible ISO") },
+});
 
-    switch (when_power_off) {
-    case SDK::CrSilentModeShutterWhenPowerOff::CrSilentModeShutterWhenPowerOff_NotTarget:
-        ts << "Not Target";
-        break;
-    case SDK::CrSilentModeShutterWhenPowerOff::CrSilentModeShutterWhenPowerOff_Off:
-        ts << "OFF";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
-}
-text format_silent_mode_auto_pixel_mapping(std::uint8_t auto_pixel_mapping)
+text_view format_movie_shooting_mode(std::uint16_t movie_shooting_mode)
 {
-    text_stringstream ts;
-
-    switch (auto_pixel_mapping) {
-    case SDK::CrSilentModeAutoPixelMapping::CrSilentModeAutoPixelMapping_NotTarget:
-        ts << "Not Target";
-        break;
-    case SDK::CrSilentModeAutoPixelMapping::CrSilentModeAutoPixelMapping_Off:
-        ts << "OFF";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+    return impl::find_name(MovieShootingModeNames, movie_shooting_mode);
 }
 
-text format_shutter_type(std::uint8_t shutter_type)
-{
-    text_stringstream ts;
+constexpr auto FocusDrivingStatusNames = impl::sorted_names({
+    { SDK::CrFocusDrivingStatus::CrFocusDrivingStatus_NotDriving, TEXT("Not Driving") },
+    { SDK::CrFocusDrivingStatus::CrFocusDrivingStatus_Driving, TEXT("Driving") },
+});
 
-    switch (shutter_type) {
-    case SDK::CrShutterType::CrShutterType_Auto:
-        ts << "Auto";
-        break;
-    case SDK::CrShutterType::CrShutterType_MechanicalShutter:
-        ts << "Mechanical Shutter";
-        break;
-    case SDK::CrShutterType::CrShutterType_ElectronicShutter:
-        ts << "Electronic Shutter";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
-}
-
-text format_movie_shooting_mode(std::uint16_t movie_shooting_mode)
-{
-    text_stringstream ts;
-
-    switch (movie_shooting_mode) {
-    case SDK::CrMovieShootingMode::CrMovieShootingMode_Off:
-        ts << "OFF";
-        break;
-    case SDK::CrMovieShootingMode::CrMovieShootingMode_CineEI:
-        ts << "Cine EI";
-        break;
-    case SDK::CrMovieShootingMode::CrMovieShootingMode_CineEIQuick:
-        ts << "Cine EI Quick";
-        break;
-    case SDK::CrMovieShootingMode::CrMovieShootingMode_Custom:
-        ts << "Custom";
-        break;
-    case SDK::CrMovieShootingMode::CrMovieShootingMode_FlexibleISO:
-        ts << "Flexible ISO";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_focus_driving_status(std::uint8_t focus_driving_status)
+{
+    return impl::find_name(FocusDrivingStatusNames, focus_driving_status);
 }
 
-text format_focus_driving_status(std::uint8_t focus_driving_status)
-{
-    text_stringstream ts;
+constexpr auto MediaSlotxRecAvailableNames = impl::sorted_names({
+    { SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_None, TEXT("None") },
+    { SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_Main, TEXT("Main") },
+    { SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_Proxy, TEXT("Proxy") },
+    { SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_MainAndProxy, TEXT("Main and Proxy") },
+});
 
-    switch (focus_driving_status) {
-    case SDK::CrFocusDrivingStatus::CrFocusDrivingStatus_NotDriving:
-        ts << "Not Driving";
-        break;
-    case SDK::CrFocusDrivingStatus::CrFocusDrivingStatus_Driving:
-        ts << "Driving";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
-}
-
-text format_media_slotx_rec_available(std::uint8_t rec_available)
-{
-    text_stringstream ts;
-
-    switch (rec_available) {
-    case SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_None:
-        ts << "None";
-        break;
-    case SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_Main:
-        ts << "Main";
-        break;
-    case SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_Proxy:
-        ts << "Proxy";
-        break;
-    case SDK::CrMediaSlotRecordingAvailableType::CrMediaSlotRecordingAvailableType_MainAndProxy:
-        ts << "Main and Proxy";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_media_slotx_rec_available(std::uint8_t rec_available)
+{
+    return impl::find_name(MediaSlotxRecAvailableNames, rec_available);
 }
 
-text format_monitoring_is_delivery(std::uint8_t sts)
-{
-    text_stringstream ts;
+constexpr auto MonitoringIsDeliveryNames = impl::sorted_names({
+    { SDK::CrMonitoringIsDelivering::CrMonitoringIsDelivering_False, TEXT("False") },
+    { SDK::CrMonitoringIsDelivering::CrMonitoringIsDelivering_True, TEXT("True") },
+});
 
-    switch (sts) {
-    case SDK::CrMonitoringIsDelivering::CrMonitoringIsDelivering_False:
-        ts << "False";
-        break;
-    case SDK::CrMonitoringIsDelivering::CrMonitoringIsDelivering_True:
-        ts << "True";
-        break;
-    default:
-        break;
-    }
-    return ts.str();
+text_view format_monitoring_is_delivery(std::uint8_t sts)
+{
+    return impl::find_name(MonitoringIsDeliveryNames, sts);
 }
 
 } // namespace cli
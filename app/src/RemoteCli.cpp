@@ -10,10 +10,14 @@ namespace fs = std::filesystem;
 #endif
 #endif
 
+#include <chrono>
 #include <cstdint>
 #include <iomanip>
+#include <map>
+#include <thread>
 #include "CameraRemote_SDK.h"
 #include "CameraDevice.h"
+#include "LiveViewSync.h"
 #include "Text.h"
 
 //#define LIVEVIEW_ENB
@@ -279,6 +283,10 @@ int main()
     camera = cameraList[no - 1];
 
 #endif
+    // Declared after cameraList, so it detaches from their streams first.
+    // LiveViewSync keeps up to MaxBuffered frames per camera plus the set it hands out.
+    cli::LiveViewMultiplexer lvMux(cli::LiveViewFrameRing::DefaultCapacity, cli::LiveViewSync::MaxBuffered + 1);
+
     // loop-A
     for (;;) {
 
@@ -397,9 +405,9 @@ int main()
                 if (action == TEXT("s")) { /* status display and device selection */
                     cli::tout << "Status display and camera switching.\n";
 #if defined(LIVEVIEW_ENB)
-                    cli::tout << "number - connected - lvEnb - model - id\n";
+                    cli::tout << "number - connected - lvEnb - model - id - exposure\n";
 #else
-                    cli::tout << "number - connected - model - id\n";
+                    cli::tout << "number - connected - model - id - exposure\n";
 #endif
                     CameraDeviceList::const_iterator it = cameraList.begin();
                     for (std::int32_t i = 0; it != cameraList.end(); ++i, ++it)
@@ -419,7 +427,19 @@ int main()
                             << " - " << ((*it)->is_live_view_enable() ? "true " : "false")
 #endif
                             << " - " << model.data()
-                            << " - " << id.data() << std::endl;
+                            << " - " << id.data();
+                        // Kept current by each camera's property worker, also for the cameras not selected
+                        auto const snapshot = (*it)->property_snapshot();
+                        if (0 < snapshot->version) {
+                            auto const& table = snapshot->table;
+                            cli::tout << " - " << cli::format_f_number(table.f_number.current)
+                                << " " << cli::format_shutter_speed(table.shutter_speed.current)
+                                << " " << cli::format_iso_sensitivity(table.iso_sensitivity.current);
+                        }
+                        else {
+                            cli::tout << " - n/a";
+                        }
+                        cli::tout << std::endl;
                     }
 
                     cli::tout << std::endl << "Selected camera number = [" << selectCamera << "]" << std::endl << std::endl;
@@ -430,6 +450,7 @@ int main()
                     cli::tout << "[0]  Create new CameraDevice\n";
 #endif
                     cli::tout << "[1]  Switch cameras for controls\n";
+                    cli::tout << "[2]  Multi-camera live view\n";
                     cli::tout << std::endl << "input> ";
 
                     cli::text input;
@@ -439,11 +460,11 @@ int main()
                     ss >> selected_index;
 
 #ifdef MSEARCH_ENB
-                    if (selected_index < 0 || 1 < selected_index) {
+                    if (selected_index < 0 || 2 < selected_index) {
                         cli::tout << "Input cancelled.\n";
                     }
 #else
-                    if (selected_index < 1 || 1 < selected_index) {
+                    if (selected_index < 1 || 2 < selected_index) {
                         cli::tout << "Input cancelled.\n";
                     }
 #endif
@@ -551,6 +572,162 @@ int main()
                             }
                         }
                     }
+                    // multi-camera live view
+                    else if (2 == selected_index) {
+                        // loop-Menu-s2
+                        while (true)
+                        {
+                            cli::tout << "<< Multi-camera Live View >>\nWhat would you like to do? Enter the corresponding number.\n";
+                            cli::tout
+                                << "(1) Add all connected cameras\n"
+                                << "(2) Remove all cameras\n"
+                                << "(3) Status\n"
+                                << "(4) Measure merged throughput (5 seconds)\n"
+                                << "(5) Time code synchronization (5 seconds)\n"
+                                << "(0) Return to REMOTE-MENU\n";
+                            cli::tout << "input> ";
+                            cli::text select;
+                            std::getline(cli::tin, select);
+                            cli::tout << '\n';
+
+                            if (select == TEXT("1")) { /* Add */
+                                cli::tout << "First core for the fetch threads, one core per camera (-1: no pinning)\n";
+                                cli::tout << "input> ";
+                                std::getline(cli::tin, input);
+                                cli::text_stringstream ss4(input);
+                                int first_cpu = -1;
+                                ss4 >> first_cpu;
+                                cli::tout << "Target frame rate per camera (0: camera rate)\n";
+                                cli::tout << "input> ";
+                                std::getline(cli::tin, input);
+                                cli::text_stringstream ss7(input);
+                                double target_fps = 0.0;
+                                ss7 >> target_fps;
+                                int const cores = static_cast<int>(std::thread::hardware_concurrency());
+                                int added = 0;
+                                for (auto const& cam : cameraList) {
+                                    if (!cam->is_connected()) {
+                                        continue;
+                                    }
+                                    int const cpu = (first_cpu < 0 || cores < 1) ? -1 : (first_cpu + added) % cores;
+                                    ++added;
+                                    cam->set_live_view_target_fps(target_fps);
+                                    cli::tout << "Camera " << cam->get_number()
+                                        << (cam->join_live_view_multiplexer(lvMux, cpu) ? " added" : " FAILED");
+                                    if (0 <= cpu) {
+                                        cli::tout << ", core " << cpu;
+                                    }
+                                    cli::tout << '\n';
+                                }
+                                if (0 == added) {
+                                    cli::tout << "No camera is connected.\n";
+                                }
+                            }
+                            else if (select == TEXT("2")) { /* Remove */
+                                // The fetch threads keep running until stopped from the Live View Stream menu
+                                for (auto const& cam : cameraList) {
+                                    cam->leave_live_view_multiplexer(lvMux);
+                                }
+                                cli::tout << "Removed all cameras.\n";
+                            }
+                            else if (select == TEXT("3")) { /* Status */
+                                cli::tout << "number - fetch thread - core - fetched - queued - dropped - rate(fps)\n";
+                                for (auto const& cam : cameraList) {
+                                    auto const queue = lvMux.queue(cam->get_number());
+                                    if (!queue) {
+                                        continue;
+                                    }
+                                    auto const& stream = cam->live_view_stream();
+                                    cli::tout << std::setfill(TEXT(' ')) << std::setw(4) << std::left << cam->get_number()
+                                        << " - " << (stream.is_running() ? "running" : "stopped")
+                                        << " - " << (stream.is_pinned() ? stream.cpu() : -1)
+                                        << " - " << stream.fetched()
+                                        << " - " << queue->size()
+                                        << " - " << queue->dropped()
+                                        << " - " << stream.governor().rate_fps()
+                                        << (stream.governor().is_throttling() ? " (throttled)" : "") << '\n';
+                                }
+                                cli::tout << "Cameras: " << lvMux.size() << ", Merged frames popped: " << lvMux.popped() << '\n';
+                            }
+                            else if (select == TEXT("4")) { /* Throughput */
+                                if (0 == lvMux.size()) {
+                                    cli::tout << "No camera has been added.\n";
+                                    continue;
+                                }
+                                std::map<std::int32_t, std::pair<std::uint64_t, std::uint64_t>> received; // frames, bytes
+                                auto const started = std::chrono::steady_clock::now();
+                                auto const until = started + std::chrono::seconds(5);
+                                while (std::chrono::steady_clock::now() < until) {
+                                    cli::LiveViewFrame* frame = lvMux.pop_wait(std::chrono::milliseconds(100));
+                                    if (!frame) {
+                                        continue;
+                                    }
+                                    auto& count = received[frame->camera];
+                                    ++count.first;
+                                    count.second += frame->size;
+                                    cli::LiveViewFramePool::release(frame);
+                                }
+                                double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+                                std::uint64_t total_frames = 0;
+                                std::uint64_t total_bytes = 0;
+                                for (auto const& count : received) {
+                                    cli::tout << "Camera " << count.first << ": " << count.second.first / seconds << " fps, "
+                                        << count.second.second / seconds / 1024 << " KiB/s\n";
+                                    total_frames += count.second.first;
+                                    total_bytes += count.second.second;
+                                }
+                                cli::tout << "Total: " << total_frames / seconds << " fps, "
+                                    << total_bytes / seconds / 1024 << " KiB/s\n";
+                            }
+                            else if (select == TEXT("5")) { /* Time code sync */
+                                if (0 == lvMux.size()) {
+                                    cli::tout << "No camera has been added.\n";
+                                    continue;
+                                }
+                                cli::LiveViewSyncConfig config;
+                                cli::tout << "Time code frame rate (24, 25, 30, 50, 60)\n";
+                                cli::tout << "input> ";
+                                std::getline(cli::tin, input);
+                                cli::text_stringstream ss5(input);
+                                ss5 >> config.fps;
+                                if (0 == config.fps) {
+                                    config.fps = 30;
+                                }
+                                cli::tout << "Tolerance in frames\n";
+                                cli::tout << "input> ";
+                                std::getline(cli::tin, input);
+                                cli::text_stringstream ss6(input);
+                                ss6 >> config.tolerance;
+
+                                cli::LiveViewSync sync(lvMux, config);
+                                cli::LiveViewSyncSet set;
+                                auto const until = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                                while (std::chrono::steady_clock::now() < until) {
+                                    if (sync.next(set, std::chrono::milliseconds(100))) {
+                                        cli::LiveViewSync::release(set);
+                                    }
+                                }
+                                cli::tout << "Matched sets: " << sync.sets() << '\n';
+                                cli::tout << "number - received - matched - stale - overflow - bad TC - offset(frames) - skew(us) mean [min, max] - drift(ppm)\n";
+                                for (auto const& stats : sync.stats()) {
+                                    cli::tout << std::setfill(TEXT(' ')) << std::setw(4) << std::left << stats.camera
+                                        << " - " << stats.received
+                                        << " - " << stats.matched
+                                        << " - " << stats.stale
+                                        << " - " << stats.overflow
+                                        << " - " << stats.invalid_time_code
+                                        << " - " << stats.offset_frames
+                                        << " - " << stats.skew_us << " [" << stats.skew_min_us << ", " << stats.skew_max_us << "]"
+                                        << " - " << stats.drift_ppm << '\n';
+                                }
+                            }
+                            else if (select == TEXT("0")) {
+                                cli::tout << "Return to REMOTE-MENU.\n";
+                                break;
+                            }
+                            cli::tout << std::endl;
+                        } // end of loop-Menu-s2
+                    }
                 } // end menu-s
 
                 else if (action == TEXT("0")) { /* Return top menu */
@@ -895,6 +1072,12 @@ int main()
                             << "(8) Get Display String Type \n"
                             << "(9) Get Display String List \n"
                             << "(10) Monitoring \n"
+                            << "(11) Live View Stream \n"
+                            << "(12) Property Decode Benchmark \n"
+                            << "(13) All Properties \n"
+                            << "(14) Apply Property Batch \n"
+                            << "(15) Property History \n"
+                            << "(16) Watch Properties \n"
                             ;
 
                         cli::tout << "input> ";
@@ -963,6 +1146,101 @@ int main()
                                 cli::tout << std::endl;
                             } // end of loop-Menu6-11
                         }
+                        else if (select == TEXT("11")) {
+                            // loop-Menu6-12
+                            while (true) {
+
+                                cli::tout << "<< Live View Stream Menu >>\nWhat would you like to do? Enter the corresponding number.\n";
+                                cli::tout
+                                    << "(0) Return to Other menu.\n"
+                                    << "(1) Start Live View Stream\n"
+                                    << "(2) Stop Live View Stream\n"
+                                    << "(3) Live View Stream Status\n"
+                                    << "(4) Start Live View Recording\n"
+                                    << "(5) Stop Live View Recording\n"
+                                    << "(6) Seek Live View Capture\n"
+                                    << "(7) Start Live View Server (MJPEG over HTTP)\n"
+                                    << "(8) Stop Live View Server\n"
+                                    << "(9) Start Live View Shared Memory\n"
+                                    << "(10) Stop Live View Shared Memory\n"
+                                    << "(11) Live View Latency\n"
+                                    << "(12) Live View Overlay\n"
+                                    << "(13) Live View Focus Score\n"
+                                    << "(14) Live View Target Frame Rate\n"
+                                    << "(15) Live View Stall Check\n"
+                                    ;
+
+                                cli::tout << "input> ";
+                                cli::text select;
+                                std::getline(cli::tin, select);
+                                cli::tout << "\n";
+                                if (select == TEXT("1")) { /* Start Live View Stream */
+                                    camera->start_live_view_stream();
+                                }
+                                else if (select == TEXT("2")) { /* Stop Live View Stream */
+                                    camera->stop_live_view_stream();
+                                }
+                                else if (select == TEXT("3")) { /* Live View Stream Status */
+                                    camera->get_live_view_stream_status();
+                                }
+                                else if (select == TEXT("4")) { /* Start Live View Recording */
+                                    camera->start_live_view_recording();
+                                }
+                                else if (select == TEXT("5")) { /* Stop Live View Recording */
+                                    camera->stop_live_view_recording();
+                                }
+                                else if (select == TEXT("6")) { /* Seek Live View Capture */
+                                    camera->seek_live_view_capture();
+                                }
+                                else if (select == TEXT("7")) { /* Start Live View Server */
+                                    camera->start_live_view_server();
+                                }
+                                else if (select == TEXT("8")) { /* Stop Live View Server */
+                                    camera->stop_live_view_server();
+                                }
+                                else if (select == TEXT("9")) { /* Start Live View Shared Memory */
+                                    camera->start_live_view_shm();
+                                }
+                                else if (select == TEXT("10")) { /* Stop Live View Shared Memory */
+                                    camera->stop_live_view_shm();
+                                }
+                                else if (select == TEXT("11")) { /* Live View Latency */
+                                    camera->get_live_view_latency();
+                                }
+                                else if (select == TEXT("12")) { /* Live View Overlay */
+                                    camera->get_live_view_overlay();
+                                }
+                                else if (select == TEXT("13")) { /* Live View Focus Score */
+                                    camera->get_live_view_focus();
+                                }
+                                else if (select == TEXT("14")) { /* Live View Target Frame Rate */
+                                    camera->set_live_view_target_fps();
+                                }
+                                else if (select == TEXT("15")) { /* Live View Stall Check */
+                                    camera->check_live_view_stall();
+                                }
+                                else if (select == TEXT("0")) {
+                                    cli::tout << "Return to Other menu.\n";
+                                    break;
+                                }
+                                cli::tout << std::endl;
+                            } // end of loop-Menu6-12
+                        }
+                        else if (select == TEXT("12")) { /* Property Decode Benchmark */
+                            camera->get_property_decode_benchmark();
+                        }
+                        else if (select == TEXT("13")) { /* All Properties */
+                            camera->get_all_properties();
+                        }
+                        else if (select == TEXT("14")) { /* Apply Property Batch */
+                            camera->apply_property_batch();
+                        }
+                        else if (select == TEXT("15")) { /* Property History */
+                            camera->get_property_history();
+                        }
+                        else if (select == TEXT("16")) { /* Watch Properties */
+                            camera->watch_properties();
+                        }
 #if defined(LIVEVIEW_ENB)
                         else if (select == TEXT("lv")) { /* LiveView Enable */
                             camera->change_live_view_enable();